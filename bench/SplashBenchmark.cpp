@@ -0,0 +1,614 @@
+#include <QApplication>
+#include <QFile>
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <QStringList>
+#include <QLabel>
+#include <QPainter>
+#include <QGraphicsDropShadowEffect>
+#include <QTemporaryDir>
+#include <QEventLoop>
+#include <QWindow>
+#include <QDateTime>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <functional>
+
+#include "SplashScreenWidget.h"
+#include "SplashShadowRenderer.h"
+#include "SplashStyleSheetCache.h"
+#include "SplashSnapshotWindow.h"
+#include "DataTableModel.h"
+
+/**
+ * @brief Micro-benchmarks for SplashScreenWidget hot paths.
+ *
+ * Usage: qt-splash-screen-bench [benchmark-name ...]
+ * Without arguments every benchmark is run. Results are printed as
+ * average cost per operation; run a Release build for meaningful numbers.
+ */
+
+namespace {
+
+struct Benchmark {
+    QString name;
+    QString description;
+    std::function<void()> run;
+};
+
+QTextStream &out()
+{
+    static QTextStream stream(stdout);
+    return stream;
+}
+
+void report(const QString &label, qint64 nsecs, int operations)
+{
+    const double perOp = (operations > 0) ? nsecs / 1000.0 / operations : 0.0;
+    out() << "  " << label.leftJustified(44, ' ')
+          << QString::number(perOp, 'f', 2).rightJustified(12, ' ') << " us/op"
+          << "  (" << operations << " ops, "
+          << QString::number(nsecs / 1.0e6, 'f', 1) << " ms)\n";
+    out().flush();
+}
+
+// ============================================================================
+// status-updates: setProgress + setStatusMessage pairs over a fixed window
+// ============================================================================
+
+/**
+ * @brief Counts backing store syncs (one UpdateRequest per painted frame).
+ */
+class FrameCounter : public QObject
+{
+public:
+    int frames = 0;
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override
+    {
+        if (event->type() == QEvent::UpdateRequest) {
+            ++frames;
+        }
+        return QObject::eventFilter(watched, event);
+    }
+};
+
+void benchStatusUpdates()
+{
+    // Same wall-clock window for both modes: pumpFrame() early-returns
+    // between frames, so a fixed update count would time FrameCoalesced
+    // doing almost nothing. Cost is reported per update and per frame.
+    const int WINDOW_FRAMES = 60;
+    const qint64 windowNs = qint64(WINDOW_FRAMES) * 16 * 1000000;
+
+    const struct {
+        SplashScreenWidget::UpdateMode mode;
+        const char *label;
+    } modes[] = {
+        {SplashScreenWidget::UpdateMode::Immediate, "Immediate"},
+        {SplashScreenWidget::UpdateMode::FrameCoalesced, "FrameCoalesced"},
+    };
+
+    for (const auto &entry : modes) {
+        SplashScreenWidget splash;
+        splash.setMinimumDisplayDuration(0);
+        splash.setTotalSteps(1000);
+        splash.setProgressMode(SplashScreenWidget::ProgressMode::Determinate);
+        splash.setUpdateMode(entry.mode);
+        splash.startSplash();
+        QApplication::processEvents();
+
+        FrameCounter counter;
+        splash.installEventFilter(&counter);
+
+        int updates = 0;
+        QElapsedTimer timer;
+        timer.start();
+        while (timer.nsecsElapsed() < windowNs) {
+            splash.setProgress(updates % 1000);
+            splash.setStatusMessage(QString("Loading item %1").arg(updates));
+            if (entry.mode == SplashScreenWidget::UpdateMode::FrameCoalesced) {
+                splash.pumpFrame();
+            }
+            ++updates;
+        }
+        const qint64 elapsed = timer.nsecsElapsed();
+        splash.removeEventFilter(&counter);
+
+        report(QString("%1 per update").arg(entry.label), elapsed, updates);
+        report(QString("%1 per painted frame").arg(entry.label), elapsed, counter.frames);
+
+        splash.close();
+        QApplication::processEvents();
+    }
+}
+
+// ============================================================================
+// drop-shadow: per-frame cost of a live effect versus a baked shadow
+// ============================================================================
+
+QPixmap makeLogoPixmap(const QSize &size)
+{
+    QPixmap logo(size);
+    logo.fill(Qt::transparent);
+    QPainter painter(&logo);
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    painter.setBrush(QColor("#11a99d"));
+    painter.setPen(Qt::NoPen);
+    painter.drawEllipse(QRect(QPoint(0, 0), size).adjusted(8, 8, -8, -8));
+    return logo;
+}
+
+void benchDropShadow()
+{
+    const int FRAMES = 500;
+    const QSize logoSize(120, 120);
+    const QPixmap logo = makeLogoPixmap(logoSize);
+    QImage frame(logoSize + QSize(80, 80), QImage::Format_ARGB32_Premultiplied);
+
+    // Live QGraphicsDropShadowEffect, as set up by the original setupUi()
+    {
+        QLabel label;
+        label.setAttribute(Qt::WA_TranslucentBackground, true);
+        label.setPixmap(logo);
+        label.setFixedSize(logoSize);
+        auto *effect = new QGraphicsDropShadowEffect(&label);
+        effect->setBlurRadius(18);
+        effect->setOffset(0, 6);
+        effect->setColor(QColor(0, 0, 0, 55));
+        label.setGraphicsEffect(effect);
+
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < FRAMES; ++i) {
+            frame.fill(Qt::transparent);
+            label.render(&frame, QPoint(40, 40), QRegion(), QWidget::DrawChildren);
+            // Any nearby repaint invalidates the effect's cached source
+            effect->update();
+        }
+        report("QGraphicsDropShadowEffect (per frame)", timer.nsecsElapsed(), FRAMES);
+    }
+
+    // Baked once, then composited as plain images
+    {
+        QElapsedTimer timer;
+        timer.start();
+        const auto shadow = SplashShadowRenderer::renderShadow(logo.toImage(), 18,
+                                                               QColor(0, 0, 0, 55));
+        report("SplashShadowRenderer bake (one-time)", timer.nsecsElapsed(), 1);
+
+        timer.restart();
+        for (int i = 0; i < FRAMES; ++i) {
+            frame.fill(Qt::transparent);
+            QPainter painter(&frame);
+            painter.drawImage(QPoint(40 - shadow.padding, 46 - shadow.padding), shadow.image);
+            painter.drawPixmap(QPoint(40, 40), logo);
+        }
+        report("Baked shadow blit (per frame)", timer.nsecsElapsed(), FRAMES);
+    }
+}
+
+// ============================================================================
+// construction: constructor + setters, then show and first synchronous paint
+// ============================================================================
+
+void benchConstruction()
+{
+    const int RUNS = 50;
+    const QString styleSheet = QCoreApplication::applicationDirPath()
+                               + "/resources/style/light.qss";
+    const QString logo = QCoreApplication::applicationDirPath()
+                         + "/resources/icons/app_logo.svg";
+
+    const struct {
+        SplashScreenWidget::RenderMode mode;
+        const char *label;
+    } modes[] = {
+        {SplashScreenWidget::RenderMode::Widgets, "Widgets"},
+        {SplashScreenWidget::RenderMode::Flat, "Flat"},
+    };
+
+    for (const auto &entry : modes) {
+        qint64 constructNs = 0;
+        qint64 firstFrameNs = 0;
+
+        for (int i = 0; i < RUNS; ++i) {
+            QElapsedTimer timer;
+            timer.start();
+            auto *splash = new SplashScreenWidget(entry.mode);
+            splash->setUpdateMode(SplashScreenWidget::UpdateMode::FrameCoalesced);
+            splash->setMinimumDisplayDuration(0);
+            if (QFile::exists(styleSheet)) {
+                splash->setStyleSheetPath(styleSheet);
+            }
+            if (QFile::exists(logo)) {
+                splash->setLogoPath(logo);
+            }
+            splash->setAppName("Benchmark");
+            splash->setAppVersion("v1.0.0");
+            splash->setCompanyName("Company");
+            constructNs += timer.nsecsElapsed();
+
+            // show() polishes and lays out; repaint() paints and flushes
+            timer.restart();
+            splash->startSplash();
+            splash->repaint();
+            firstFrameNs += timer.nsecsElapsed();
+
+            splash->close();
+            delete splash;
+            QApplication::processEvents();
+        }
+
+        report(QString("%1: construction").arg(entry.label), constructNs, RUNS);
+        report(QString("%1: show to first frame").arg(entry.label), firstFrameNs, RUNS);
+    }
+}
+
+// ============================================================================
+// polish: applying a theme to the splash, whole file versus pruned rules
+// ============================================================================
+
+void benchPolish()
+{
+    const int RUNS = 50;
+    const QStringList themes = {"light", "dark"};
+
+    for (const QString &theme : themes) {
+        QFile file(QCoreApplication::applicationDirPath() + "/resources/style/" + theme + ".qss");
+        if (!file.open(QFile::ReadOnly | QFile::Text)) {
+            out() << "  " << theme << ".qss not found next to the executable, skipped\n";
+            continue;
+        }
+        const QString full = QString::fromUtf8(file.readAll());
+
+        QString pruned;
+        {
+            SplashScreenWidget probe;
+            pruned = SplashStyleSheetCache::prune(full, SplashStyleSheetCache::scopeOf(&probe));
+        }
+        out() << "  " << theme << ".qss: " << full.size() << " -> " << pruned.size() << " chars\n";
+
+        const struct {
+            const QString *styleSheet;
+            const char *label;
+        } variants[] = {
+            {&full, "full"},
+            {&pruned, "pruned"},
+        };
+
+        for (const auto &variant : variants) {
+            qint64 nsecs = 0;
+            for (int i = 0; i < RUNS; ++i) {
+                SplashScreenWidget splash;
+                QElapsedTimer timer;
+                timer.start();
+                splash.setStyleSheet(*variant.styleSheet);
+                splash.ensurePolished();
+                for (QWidget *child : splash.findChildren<QWidget *>()) {
+                    child->ensurePolished();
+                }
+                nsecs += timer.nsecsElapsed();
+            }
+            report(QString("%1 (%2): setStyleSheet + polish").arg(theme, variant.label), nsecs, RUNS);
+        }
+    }
+}
+
+// ============================================================================
+// configure: the example's setter sequence, applied one by one versus
+// batched between beginUpdate() and endUpdate()
+// ============================================================================
+
+void benchConfigure()
+{
+    const int RUNS = 20;
+    const QString styleSheet = QCoreApplication::applicationDirPath()
+                               + "/resources/style/light.qss";
+    const QString logo = QCoreApplication::applicationDirPath()
+                         + "/resources/icons/app_logo.svg";
+
+    for (const bool batched : {false, true}) {
+        qint64 nsecs = 0;
+        SplashScreenWidget::UpdateStats stats;
+        for (int i = 0; i < RUNS; ++i) {
+            SplashScreenWidget splash;
+            splash.setLogoCacheDirectory(QString());
+            splash.setStyleSheetCacheDirectory(QString());
+            splash.resetUpdateStats();
+
+            QElapsedTimer timer;
+            timer.start();
+            if (batched) {
+                splash.beginUpdate();
+            }
+            splash.setStyleSheetPath(styleSheet);
+            splash.setWindowSize(QSize(500, 400));
+            splash.setLogoPath(logo);
+            splash.setLogoSize(QSize(120, 120));
+            splash.setCompanyLogoPath(logo);
+            splash.setCompanyLogoSize(QSize(110, 30));
+            splash.setAppName("Benchmark");
+            if (batched) {
+                splash.endUpdate();
+            }
+            splash.ensurePolished();
+            QApplication::sendPostedEvents(&splash, QEvent::LayoutRequest);
+            nsecs += timer.nsecsElapsed();
+            stats = splash.updateStats();
+        }
+        const QString label = batched ? "batched" : "one by one";
+        report(QString("%1: configure").arg(label), nsecs, RUNS);
+        out() << "    rasterizations " << stats.rasterizations
+              << ", polishes " << stats.polishes
+              << ", layouts " << stats.layouts << " per run\n";
+    }
+}
+
+// ============================================================================
+// memory: rasters held by a finished splash, before and after release
+// ============================================================================
+
+void benchMemory()
+{
+    const QString styleSheet = QCoreApplication::applicationDirPath()
+                               + "/resources/style/light.qss";
+    const QString logo = QCoreApplication::applicationDirPath()
+                         + "/resources/icons/app_logo.svg";
+
+    SplashScreenWidget splash;
+    splash.setSnapshotPath(QString());
+    splash.setMinimumDisplayDuration(0);
+    splash.setClosingDelay(0);
+    splash.setStyleSheetPath(styleSheet);
+    splash.setLogoPath(logo);
+    splash.setCompanyLogoPath(logo);
+    splash.startSplash();
+    splash.repaint();
+
+    auto print = [](const char *label, const SplashScreenWidget::MemoryFootprint &footprint) {
+        out() << "  " << QString(label).leftJustified(44, ' ')
+              << QString::number(footprint.total() / 1024.0, 'f', 1).rightJustified(12, ' ') << " KiB"
+              << "  (pixmaps " << footprint.pixmapBytes
+              << ", images " << footprint.imageBytes
+              << ", mapped " << footprint.mappedBytes << ")\n";
+    };
+    print("Shown", splash.memoryFootprint());
+
+    QEventLoop loop;
+    QObject::connect(&splash, &SplashScreenWidget::splashFinished, &loop, &QEventLoop::quit);
+    splash.finishSplash();
+    loop.exec();
+    QApplication::processEvents();
+    print("Closed", splash.memoryFootprint());
+
+    QElapsedTimer timer;
+    timer.start();
+    splash.releaseResources();
+    report("releaseResources()", timer.nsecsElapsed(), 1);
+    print("Released", splash.memoryFootprint());
+}
+
+// ============================================================================
+// table-rows: bytes per row of the example data table, five QStrings per
+// row versus typed columns in DataTableModel
+// ============================================================================
+
+qint64 stringBytes(const QString &string)
+{
+    // Array header plus UTF-16 capacity with terminator; excludes
+    // allocator overhead, so real usage is somewhat higher
+    return qint64(sizeof(QString)) + 16 + (string.capacity() + 1) * qint64(sizeof(QChar));
+}
+
+void benchTableRows()
+{
+    const QStringList &statuses = DataTableModel::statusNames();
+    const qint64 now = QDateTime::currentSecsSinceEpoch();
+
+    for (int rowCount : {10000, 1000000}) {
+        // Former layout: one QStringList of formatted fields per row
+        qint64 stringTotal = 0;
+        QElapsedTimer timer;
+        timer.start();
+        for (int row = 0; row < rowCount; ++row) {
+            QStringList fields;
+            fields << QString::number(row + 1)
+                   << QString("Item_%1").arg(row + 1, 5, 10, QChar('0'))
+                   << QString::number(row % 200 - 100.0 + 0.25, 'f', 2)
+                   << statuses.at(row % statuses.size())
+                   << QDateTime::fromSecsSinceEpoch(now - row % 86400).toString("yyyy-MM-dd hh:mm:ss");
+            // Status strings share the interned data: count only the handle
+            stringTotal += qint64(sizeof(QStringList)) + 16 + qint64(sizeof(QString));
+            for (int field = 0; field < fields.size(); ++field) {
+                if (field != DataTableModel::StatusColumn) {
+                    stringTotal += stringBytes(fields.at(field));
+                }
+            }
+        }
+        report(QString("%L1 string rows").arg(rowCount), timer.nsecsElapsed(), rowCount);
+
+        DataTableModel model;
+        DataTableModel::Rows rows;
+        rows.reserve(rowCount);
+        timer.restart();
+        for (int row = 0; row < rowCount; ++row) {
+            rows.append(row + 1, row % 200 - 100.0 + 0.25,
+                        static_cast<std::uint8_t>(row % statuses.size()), now - row % 86400);
+        }
+        model.appendRows(rows);
+        report(QString("%L1 compact rows").arg(rowCount), timer.nsecsElapsed(), rowCount);
+
+        out() << "  " << QString("%L1 rows, bytes per row").arg(rowCount).leftJustified(44, ' ')
+              << QString::number(double(stringTotal) / rowCount, 'f', 1).rightJustified(12, ' ')
+              << " strings, "
+              << QString::number(double(model.storageBytes()) / rowCount, 'f', 1)
+              << " compact (" << DataTableModel::bytesPerRow() << " per row + vector slack)\n";
+        out().flush();
+    }
+}
+
+// ============================================================================
+// table-generate: example table generation throughput for 1..N threads,
+// chunked the way MainWindow::taskPopulateDataTable() chunks it
+// ============================================================================
+
+void benchTableGenerate()
+{
+    const int TOTAL_ROWS = 1000000;
+    const int MIN_CHUNK_ROWS = 256;
+    const quint32 SEED = 0x5eed1234;
+    const qint64 now = QDateTime::currentSecsSinceEpoch();
+
+    const int maxThreads = qMax(1, QThread::idealThreadCount());
+    QVector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.append(threads);
+    }
+    threadCounts.append(maxThreads);
+
+    double singleThreadRate = 0.0;
+    for (int threads : threadCounts) {
+        QThreadPool pool;
+        pool.setMaxThreadCount(threads);
+
+        const int chunkRows = qMax(MIN_CHUNK_ROWS, (TOTAL_ROWS + threads * 4 - 1) / (threads * 4));
+        QVector<int> chunkStarts;
+        for (int first = 0; first < TOTAL_ROWS; first += chunkRows) {
+            chunkStarts.append(first);
+        }
+        std::function<int(int)> generateChunk = [chunkRows, now, total = TOTAL_ROWS,
+                                                 seed = SEED](int first) {
+            return DataTableModel::generateRows(first, qMin(chunkRows, total - first), seed, now)
+                .size();
+        };
+
+        QElapsedTimer timer;
+        timer.start();
+        QFuture<int> chunks = QtConcurrent::mapped(&pool, chunkStarts, generateChunk);
+        chunks.waitForFinished();
+        const qint64 elapsed = timer.nsecsElapsed();
+
+        const double rate = TOTAL_ROWS / (elapsed / 1.0e9);
+        if (threads == 1) {
+            singleThreadRate = rate;
+        }
+        out() << "  " << QString("%1 thread(s)").arg(threads).leftJustified(44, ' ')
+              << QString::number(rate / 1.0e6, 'f', 2).rightJustified(12, ' ') << " Mrows/s"
+              << "  (x" << QString::number(rate / singleThreadRate, 'f', 2) << ", "
+              << QString::number(elapsed / 1.0e6, 'f', 1) << " ms)\n";
+        out().flush();
+    }
+}
+
+// ============================================================================
+// first-pixel: process-level work before the first splash frame is on
+// screen, live widget versus saved snapshot in a raw window
+// ============================================================================
+
+void waitForExpose(QWindow *window)
+{
+    QElapsedTimer timeout;
+    timeout.start();
+    while (window && !window->isExposed() && timeout.elapsed() < 500) {
+        QApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
+    }
+}
+
+void benchFirstPixel()
+{
+    const int RUNS = 20;
+    const QString styleSheet = QCoreApplication::applicationDirPath()
+                               + "/resources/style/light.qss";
+    const QString logo = QCoreApplication::applicationDirPath()
+                         + "/resources/icons/app_logo.svg";
+
+    QTemporaryDir directory;
+    const QString snapshotPath = directory.filePath("snapshot.bundle");
+
+    auto configure = [&](SplashScreenWidget *splash) {
+        splash->setUpdateMode(SplashScreenWidget::UpdateMode::FrameCoalesced);
+        splash->setMinimumDisplayDuration(0);
+        splash->setSnapshotPath(QString());
+        if (QFile::exists(styleSheet)) {
+            splash->setStyleSheetPath(styleSheet);
+        }
+        if (QFile::exists(logo)) {
+            splash->setLogoPath(logo);
+        }
+        splash->setAppName("Benchmark");
+        splash->setAppVersion("v1.0.0");
+    };
+
+    qint64 liveNs = 0;
+    for (int i = 0; i < RUNS; ++i) {
+        QElapsedTimer timer;
+        timer.start();
+        auto *splash = new SplashScreenWidget;
+        configure(splash);
+        splash->startSplash();
+        waitForExpose(splash->windowHandle());
+        splash->repaint();
+        liveNs += timer.nsecsElapsed();
+
+        if (i == 0) {
+            SplashSnapshotWindow::save(snapshotPath, splash->grab().toImage(),
+                                       splash->isOpaqueMasked());
+        }
+        splash->close();
+        delete splash;
+        QApplication::processEvents();
+    }
+    report("Live widget: construct, show, first frame", liveNs, RUNS);
+
+    qint64 snapshotNs = 0;
+    int shown = 0;
+    for (int i = 0; i < RUNS; ++i) {
+        QElapsedTimer timer;
+        timer.start();
+        std::unique_ptr<SplashSnapshotWindow> window(SplashSnapshotWindow::loadSnapshot(snapshotPath));
+        if (!window) {
+            break;
+        }
+        window->present();
+        snapshotNs += timer.nsecsElapsed();
+        ++shown;
+        window->hide();
+        window.reset();
+        QApplication::processEvents();
+    }
+    report("Snapshot window: map, create, show, first blit", snapshotNs, shown);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QApplication app(argc, argv);
+
+    const QVector<Benchmark> benchmarks = {
+        {"status-updates", "Progress + status changes in a fixed window, per update and per frame", benchStatusUpdates},
+        {"drop-shadow", "Logo drop shadow: live effect versus baked image", benchDropShadow},
+        {"construction", "Construction and time to first frame: widget tree versus flat", benchConstruction},
+        {"polish", "Stylesheet polish per theme: whole file versus pruned rules", benchPolish},
+        {"configure", "Setter sequence: applied one by one versus batched", benchConfigure},
+        {"memory", "Raster memory of a finished splash, before and after release", benchMemory},
+        {"table-rows", "Example table storage per row: strings versus typed columns", benchTableRows},
+        {"table-generate", "Example table generation: rows/s for 1..N threads", benchTableGenerate},
+        {"first-pixel", "Time to first splash pixel: live widget versus snapshot", benchFirstPixel},
+    };
+
+    const QStringList selected = app.arguments().mid(1);
+    for (const auto &benchmark : benchmarks) {
+        if (!selected.isEmpty() && !selected.contains(benchmark.name)) {
+            continue;
+        }
+        out() << benchmark.name << ": " << benchmark.description << "\n";
+        benchmark.run();
+        out() << "\n";
+    }
+
+    return 0;
+}
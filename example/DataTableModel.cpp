@@ -0,0 +1,182 @@
+#include "DataTableModel.h"
+#include <QColor>
+#include <QDateTime>
+#include <QtMath>
+#include <iterator>
+
+namespace {
+// Foreground per status, same order as statusNames(); invalid = default
+const QColor STATUS_COLORS[] = {
+    QColor("#27ae60"),  // Active
+    QColor("#f39c12"),  // Pending
+    QColor(),           // Completed
+    QColor("#e74c3c"),  // Failed
+    QColor("#3498db"),  // Processing
+};
+
+// SplitMix64 finalizer: well-mixed 64 bits per (seed, row)
+quint64 rowHash(quint32 seed, int row)
+{
+    quint64 z = (quint64(seed) << 32 | quint32(row)) + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+}
+
+void DataTableModel::Rows::reserve(int count)
+{
+    ids.reserve(count);
+    values.reserve(count);
+    statuses.reserve(count);
+    timestamps.reserve(count);
+}
+
+void DataTableModel::Rows::append(qint32 id, double value, std::uint8_t status, qint64 timestamp)
+{
+    ids.append(id);
+    values.append(value);
+    statuses.append(status);
+    timestamps.append(timestamp);
+}
+
+DataTableModel::DataTableModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+DataTableModel::Rows DataTableModel::generateRows(int first, int count, quint32 seed,
+                                                  qint64 baseTimestamp,
+                                                  const std::atomic<bool> *cancelled)
+{
+    const quint64 statusCount = quint64(statusNames().size());
+
+    Rows rows;
+    rows.reserve(count);
+    for (int row = first; row < first + count; ++row) {
+        if (cancelled && (row & 0xff) == 0 && cancelled->load(std::memory_order_relaxed)) {
+            break;
+        }
+        // Disjoint bit ranges of one hash for the three random fields
+        const quint64 hash = rowHash(seed, row);
+        const double value = qSin(row * 0.1) * 100 + double(hash % 50);
+        const auto status = static_cast<std::uint8_t>((hash >> 16) % statusCount);
+        const qint64 timestamp = baseTimestamp - qint64((hash >> 32) % 86400);
+
+        rows.append(row + 1, value, status, timestamp);
+    }
+    return rows;
+}
+
+const QStringList &DataTableModel::statusNames()
+{
+    static const QStringList names = {"Active", "Pending", "Completed", "Failed", "Processing"};
+    return names;
+}
+
+int DataTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+int DataTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant DataTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_rows.size() || index.column() >= ColumnCount) {
+        return QVariant();
+    }
+    const int row = index.row();
+
+    switch (role) {
+    case Qt::DisplayRole:
+        // Formatted on demand: only visible cells are ever turned into text
+        switch (index.column()) {
+        case IdColumn:
+            return QString::number(m_rows.ids.at(row));
+        case NameColumn:
+            return QString("Item_%1").arg(m_rows.ids.at(row), 5, 10, QChar('0'));
+        case ValueColumn:
+            return QString::number(m_rows.values.at(row), 'f', 2);
+        case StatusColumn:
+            return statusNames().value(m_rows.statuses.at(row));
+        case TimestampColumn:
+            return QDateTime::fromSecsSinceEpoch(m_rows.timestamps.at(row))
+                .toString("yyyy-MM-dd hh:mm:ss");
+        }
+        return QVariant();
+
+    case Qt::TextAlignmentRole:
+        // Right-align numeric columns
+        if (index.column() == IdColumn || index.column() == ValueColumn) {
+            return QVariant(Qt::AlignRight | Qt::AlignVCenter);
+        }
+        return QVariant(Qt::AlignLeft | Qt::AlignVCenter);
+
+    case Qt::ForegroundRole: {
+        // Color-code status column
+        if (index.column() != StatusColumn) {
+            return QVariant();
+        }
+        const std::uint8_t status = m_rows.statuses.at(row);
+        if (status < std::size(STATUS_COLORS) && STATUS_COLORS[status].isValid()) {
+            return STATUS_COLORS[status];
+        }
+        return QVariant();
+    }
+
+    default:
+        return QVariant();
+    }
+}
+
+QVariant DataTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role != Qt::DisplayRole) {
+        return QVariant();
+    }
+    if (orientation == Qt::Vertical) {
+        return section + 1;
+    }
+
+    static const char *const titles[ColumnCount] = {"ID", "Name", "Value", "Status", "Timestamp"};
+    return (section >= 0 && section < ColumnCount) ? QString(titles[section]) : QVariant();
+}
+
+void DataTableModel::appendRows(const Rows &rows)
+{
+    if (rows.isEmpty()) {
+        return;
+    }
+
+    const int first = m_rows.size();
+    beginInsertRows(QModelIndex(), first, first + rows.size() - 1);
+    m_rows.ids.append(rows.ids);
+    m_rows.values.append(rows.values);
+    m_rows.statuses.append(rows.statuses);
+    m_rows.timestamps.append(rows.timestamps);
+    endInsertRows();
+}
+
+void DataTableModel::reserve(int count)
+{
+    m_rows.reserve(count);
+}
+
+void DataTableModel::clear()
+{
+    beginResetModel();
+    m_rows = Rows();
+    endResetModel();
+}
+
+qint64 DataTableModel::storageBytes() const
+{
+    return m_rows.ids.capacity() * qint64(sizeof(qint32))
+           + m_rows.values.capacity() * qint64(sizeof(double))
+           + m_rows.statuses.capacity() * qint64(sizeof(std::uint8_t))
+           + m_rows.timestamps.capacity() * qint64(sizeof(qint64));
+}
@@ -0,0 +1,103 @@
+#ifndef DATATABLEMODEL_H
+#define DATATABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QStringList>
+#include <QVector>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Table model over compact, typed columnar storage.
+ *
+ * Replaces one heap-allocated QTableWidgetItem per cell. Each column is
+ * one contiguous vector of plain values: the id, the value, a status
+ * index into a fixed table of interned names and the timestamp in epoch
+ * seconds. The name is derived from the id. Text, alignment and colors
+ * are produced in data() for the cells the view actually paints, so a
+ * row costs a fixed handful of bytes whatever the table size.
+ */
+class DataTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column {
+        IdColumn,
+        NameColumn,
+        ValueColumn,
+        StatusColumn,
+        TimestampColumn,
+        ColumnCount
+    };
+
+    /**
+     * @brief Rows in the same columnar layout, built off the GUI thread
+     * and appended with appendRows()
+     */
+    struct Rows {
+        QVector<qint32> ids;
+        QVector<double> values;
+        QVector<std::uint8_t> statuses;  ///< Index into statusNames()
+        QVector<qint64> timestamps;      ///< Seconds since epoch (UTC)
+
+        int size() const { return static_cast<int>(ids.size()); }
+        bool isEmpty() const { return ids.isEmpty(); }
+        void reserve(int count);
+        void append(qint32 id, double value, std::uint8_t status, qint64 timestamp);
+    };
+
+    explicit DataTableModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief Append @p rows at the end of the table (GUI thread)
+     */
+    void appendRows(const Rows &rows);
+
+    /**
+     * @brief Reserve storage for @p count rows in total
+     */
+    void reserve(int count);
+
+    void clear();
+
+    /**
+     * @brief Generate rows [first, first + count) of the example table.
+     *
+     * Every row is a pure function of (seed, row index): a counter-based
+     * hash, not a generator carried across rows. Any chunking, on any
+     * number of threads, produces the same table. Stops early once
+     * @p cancelled is set.
+     */
+    static Rows generateRows(int first, int count, quint32 seed, qint64 baseTimestamp,
+                             const std::atomic<bool> *cancelled = nullptr);
+
+    /**
+     * @brief Interned status names; Rows::statuses index into this table
+     */
+    static const QStringList &statusNames();
+
+    /**
+     * @brief Bytes held by the column storage (capacity, not size)
+     */
+    qint64 storageBytes() const;
+
+    /**
+     * @brief Bytes of column storage per row
+     */
+    static constexpr int bytesPerRow()
+    {
+        return sizeof(qint32) + sizeof(double) + sizeof(std::uint8_t) + sizeof(qint64);
+    }
+
+private:
+    Rows m_rows;
+};
+
+#endif // DATATABLEMODEL_H
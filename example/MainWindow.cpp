@@ -1,10 +1,13 @@
 #include "MainWindow.h"
+#include "SplashStartup.h"
 #include <QDebug>
 #include <QDateTime>
 #include <QApplication>
 #include <QThread>
 #include <QRandomGenerator>
 #include <QtConcurrent>
+#include <QThreadPool>
+#include <QElapsedTimer>
 #include <QTimer>
 #include <QHeaderView>
 
@@ -13,24 +16,37 @@
 // ============================================================================
 
 MainWindow::MainWindow(QWidget *parent)
+    : MainWindow(UiConstruction::Immediate, parent)
+{
+}
+
+MainWindow::MainWindow(UiConstruction construction, QWidget *parent)
     : QMainWindow(parent)
     , m_centralWidget(nullptr)
     , m_mainLayout(nullptr)
     , m_titleLabel(nullptr)
     , m_logTextEdit(nullptr)
     , m_dataTable(nullptr)
+    , m_dataModel(nullptr)
     , m_statusLabel(nullptr)
-    , m_currentTaskIndex(0)
+    , m_scheduler(nullptr)
     , m_cancelled(false)
+    , m_tableDrainScheduled(false)
     , m_workerThread(nullptr)
 {
     setupInitializationTasks();
-    setupUi();
+    if (construction == UiConstruction::Immediate) {
+        setupUi();
+    }
 }
 
 MainWindow::~MainWindow()
 {
     m_cancelled = true;
+    if (m_scheduler) {
+        m_scheduler->cancel();
+        m_scheduler->waitForDone(3000);
+    }
     if (m_workerThread) {
         m_workerThread->quit();
         m_workerThread->wait(3000);
@@ -39,6 +55,22 @@ MainWindow::~MainWindow()
 }
 
 void MainWindow::setupUi()
+{
+    setupFrame();
+    setupLogView();
+    setupDataTable();
+    setupStatusBar();
+}
+
+void MainWindow::addConstructionSlices(SplashStartup &startup)
+{
+    startup.addSlice("frame", [this]() { setupFrame(); });
+    startup.addSlice("log", [this]() { setupLogView(); });
+    startup.addSlice("table", [this]() { setupDataTable(); });
+    startup.addSlice("status", [this]() { setupStatusBar(); });
+}
+
+void MainWindow::setupFrame()
 {
     setWindowTitle("Qt Splash Screen Demo - Main Application");
     setMinimumSize(800, 600);
@@ -55,7 +87,10 @@ void MainWindow::setupUi()
     m_titleLabel->setStyleSheet("font-size: 24px; font-weight: bold; color: #2c3e50;");
     m_titleLabel->setAlignment(Qt::AlignCenter);
     m_mainLayout->addWidget(m_titleLabel);
+}
 
+void MainWindow::setupLogView()
+{
     // Log area
     QLabel *logLabel = new QLabel("Initialization Log:", this);
     logLabel->setStyleSheet("font-size: 14px; font-weight: bold; color: #34495e;");
@@ -76,19 +111,27 @@ void MainWindow::setupUi()
         "}"
     );
     m_mainLayout->addWidget(m_logTextEdit);
+}
 
+void MainWindow::setupDataTable()
+{
     // Data table (populated during initialization with 10k rows)
     QLabel *tableLabel = new QLabel("Data Table (10,000 rows loaded during init):", this);
     tableLabel->setStyleSheet("font-size: 14px; font-weight: bold; color: #34495e;");
     m_mainLayout->addWidget(tableLabel);
 
-    m_dataTable = new QTableWidget(this);
-    m_dataTable->setColumnCount(5);
-    m_dataTable->setHorizontalHeaderLabels({"ID", "Name", "Value", "Status", "Timestamp"});
+    // Model/view: rows live in columnar storage, cells are only formatted
+    // when painted, so the row count does not drive allocations
+    m_dataModel = new DataTableModel(this);
+    m_dataTable = new QTableView(this);
+    m_dataTable->setModel(m_dataModel);
     m_dataTable->horizontalHeader()->setStretchLastSection(true);
+    // Uniform row heights: no per-row size hints to measure
+    m_dataTable->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    m_dataTable->verticalHeader()->setDefaultSectionSize(m_dataTable->fontMetrics().height() + 8);
     m_dataTable->setAlternatingRowColors(true);
     m_dataTable->setStyleSheet(
-        "QTableWidget {"
+        "QTableView {"
         "  background-color: #ffffff;"
         "  alternate-background-color: #f5f5f5;"
         "  border: 1px solid #3498db;"
@@ -104,7 +147,10 @@ void MainWindow::setupUi()
         "}"
     );
     m_mainLayout->addWidget(m_dataTable, 1);  // stretch factor 1
+}
 
+void MainWindow::setupStatusBar()
+{
     // Status bar
     m_statusLabel = new QLabel("Ready", this);
     m_statusLabel->setStyleSheet(
@@ -116,106 +162,107 @@ void MainWindow::setupUi()
 
 void MainWindow::setupInitializationTasks()
 {
-    // Define initialization tasks with their methods
-    // isHeavyTask = true means the task will run on a worker thread
+    // Define initialization tasks with their methods and dependencies.
+    // isHeavyTask = true means the task will run on a worker thread.
+    // Tasks without a dependency path between them run concurrently.
     m_initTasks = {
         {"config",      "Loading configuration files",
-            [this]() { taskLoadConfiguration(); }, false},
+            [this]() { taskLoadConfiguration(); }, false, {}},
 
         {"database",    "Initializing database connection",
-            [this]() { taskInitializeDatabase(); }, true},
+            [this]() { taskInitializeDatabase(); }, true, {"config"}},
 
         {"preferences", "Loading user preferences",
-            [this]() { taskLoadUserPreferences(); }, false},
+            [this]() { taskLoadUserPreferences(); }, false, {"config"}},
 
         {"ui",          "Preparing UI components",
-            [this]() { taskPrepareUIComponents(); }, true},
+            [this]() { taskPrepareUIComponents(); }, true, {"preferences"}},
 
         {"plugins",     "Loading plugins",
-            [this]() { taskLoadPlugins(); }, true},
+            [this]() { taskLoadPlugins(); }, true, {"config"}},
 
         {"license",     "Verifying license",
-            [this]() { taskVerifyLicense(); }, false},
+            [this]() { taskVerifyLicense(); }, false, {"config"}},
 
         {"services",    "Connecting to services",
-            [this]() { taskConnectToServices(); }, true},
+            [this]() { taskConnectToServices(); }, true, {"license"}},
 
         {"datatable",   "Populating data table (10,000 rows)",
-            [this]() { taskPopulateDataTable(); }, true}
+            [this]() { taskPopulateDataTable(); }, true, {"database", "ui"}}
     };
 }
 
 void MainWindow::initialize()
 {
-    m_currentTaskIndex = 0;
     m_cancelled = false;
 
     logMessage("Starting initialization...");
 
-    // Start the first task
-    runNextTask();
-}
+    delete m_scheduler;
+    m_scheduler = new StartupTaskScheduler(this);
 
-void MainWindow::runNextTask()
-{
-    if (m_cancelled) {
-        return;
+    // Worker tasks mostly wait on I/O, so allow all of them to overlap
+    int heavyTasks = 0;
+    for (const auto &task : m_initTasks) {
+        const auto affinity = task.isHeavyTask
+            ? StartupTaskScheduler::Affinity::WorkerThread
+            : StartupTaskScheduler::Affinity::MainThread;
+        m_scheduler->addTask(task.name, task.description, task.taskMethod,
+                             affinity, task.dependencies);
+        if (task.isHeavyTask) {
+            heavyTasks++;
+        }
     }
+    m_scheduler->setMaxConcurrency(qMax(heavyTasks, QThread::idealThreadCount()));
+
+    connect(m_scheduler, &StartupTaskScheduler::taskStarted,
+            this, &MainWindow::onTaskStarted);
+    connect(m_scheduler, &StartupTaskScheduler::taskFinished,
+            this, &MainWindow::onTaskFinished);
+    connect(m_scheduler, &StartupTaskScheduler::allTasksFinished,
+            this, &MainWindow::onAllTasksFinished);
+    connect(m_scheduler, &StartupTaskScheduler::failed,
+            this, &MainWindow::initializationFailed);
+
+    m_scheduler->start();
+}
 
-    if (m_currentTaskIndex >= m_initTasks.size()) {
-        // All tasks completed
-        logMessage("========================================");
-        logMessage("All initialization tasks completed!");
-        logMessage("========================================");
-
-        m_statusLabel->setText("All systems operational");
-        m_statusLabel->setStyleSheet(
-            "font-size: 12px; color: #ffffff; padding: 5px; "
-            "background-color: #27ae60; border-radius: 3px; font-weight: bold;"
-        );
+void MainWindow::onTaskStarted(const QString &name, const QString &description)
+{
+    // Emit signals for splash screen (1-based step being worked towards)
+    emit initializationTaskStarted(name);
+    emit initializationStepStarted(m_scheduler->completedCount() + 1, description);
+    logTaskStart(description);
+}
 
-        emit initializationComplete();
+void MainWindow::onTaskFinished(const QString &name, int completed)
+{
+    if (m_cancelled) {
         return;
     }
 
-    const InitTask &task = m_initTasks[m_currentTaskIndex];
-
-    // Emit signal for splash screen (1-based step)
-    emit initializationStepStarted(m_currentTaskIndex + 1, task.description);
-    logTaskStart(task.description);
-
-    if (task.isHeavyTask) {
-        // Run heavy task in a separate thread using QtConcurrent
-        QFuture<void> future = QtConcurrent::run([this, task]() {
-            task.taskMethod();
-
-            // When done, notify main thread using QMetaObject::invokeMethod
-            QMetaObject::invokeMethod(this, "onTaskCompleted", Qt::QueuedConnection);
-        });
-    } else {
-        // Run quick task on main thread but use a timer to not block UI
-        QTimer::singleShot(0, this, [this, task]() {
-            task.taskMethod();
-            onTaskCompleted();
-        });
-    }
+    logTaskComplete(m_scheduler->taskDescription(name));
+    emit initializationTaskFinished(name);
+    emit initializationStepCompleted(completed);
 }
 
-void MainWindow::onTaskCompleted()
+void MainWindow::onAllTasksFinished()
 {
     if (m_cancelled) {
         return;
     }
 
-    // Log completion on the main thread
-    QMetaObject::invokeMethod(this, [this]() {
-        logTaskComplete();
-        emit initializationStepCompleted(m_currentTaskIndex + 1);
+    logMessage("========================================");
+    logMessage("All initialization tasks completed!");
+    logMessage("========================================");
+
+    m_statusLabel->setText("All systems operational");
+    m_statusLabel->setStyleSheet(
+        "font-size: 12px; color: #ffffff; padding: 5px; "
+        "background-color: #27ae60; border-radius: 3px; font-weight: bold;"
+    );
 
-        // Move to next task
-        m_currentTaskIndex++;
-        runNextTask();
-    }, Qt::QueuedConnection);
+    emit initializationComplete();
 }
 
 QStringList MainWindow::getInitializationTasks() const
@@ -227,11 +274,39 @@ QStringList MainWindow::getInitializationTasks() const
     return tasks;
 }
 
+QStringList MainWindow::getInitializationTaskNames() const
+{
+    QStringList names;
+    for (const auto &task : m_initTasks) {
+        names.append(task.name);
+    }
+    return names;
+}
+
 int MainWindow::getInitializationStepCount() const
 {
     return m_initTasks.size();
 }
 
+void MainWindow::setTaskReporter(const QString &taskName, const SplashStepReporter &reporter)
+{
+    m_taskReporters.insert(taskName, reporter);
+}
+
+void MainWindow::setProgressChannel(std::shared_ptr<SplashProgressChannel> channel)
+{
+    m_progressChannel = std::move(channel);
+}
+
+void MainWindow::reportTaskProgress(const QString &taskName, qreal fraction) const
+{
+    // Safe from worker threads: the hash is not modified while tasks run
+    const auto it = m_taskReporters.constFind(taskName);
+    if (it != m_taskReporters.constEnd()) {
+        it->setFraction(fraction);
+    }
+}
+
 void MainWindow::logMessage(const QString &message)
 {
     // Ensure we're on the main thread for UI updates
@@ -259,17 +334,17 @@ void MainWindow::logTaskStart(const QString &taskName)
     m_logTextEdit->append(QString("[%1] >> %2...").arg(timestamp, taskName));
 }
 
-void MainWindow::logTaskComplete()
+void MainWindow::logTaskComplete(const QString &taskName)
 {
     if (QThread::currentThread() != QApplication::instance()->thread()) {
-        QMetaObject::invokeMethod(this, [this]() {
-            logTaskComplete();
+        QMetaObject::invokeMethod(this, [this, taskName]() {
+            logTaskComplete(taskName);
         }, Qt::QueuedConnection);
         return;
     }
 
     QString timestamp = QDateTime::currentDateTime().toString("hh:mm:ss.zzz");
-    m_logTextEdit->append(QString("[%1]    [OK]").arg(timestamp));
+    m_logTextEdit->append(QString("[%1]    [OK] %2").arg(timestamp, taskName));
 }
 
 // ============================================================================
@@ -302,6 +377,7 @@ void MainWindow::taskInitializeDatabase()
     while (elapsed < duration && !m_cancelled) {
         QThread::msleep(chunkSize);
         elapsed += chunkSize;
+        reportTaskProgress("database", qreal(elapsed) / duration);
     }
 
     // Example:
@@ -336,6 +412,7 @@ void MainWindow::taskPrepareUIComponents()
     while (elapsed < duration && !m_cancelled) {
         QThread::msleep(chunkSize);
         elapsed += chunkSize;
+        reportTaskProgress("ui", qreal(elapsed) / duration);
 
         // Example: compute some data that will be displayed
         // for (int i = 0; i < 1000; i++) {
@@ -361,6 +438,7 @@ void MainWindow::taskLoadPlugins()
     while (elapsed < duration && !m_cancelled) {
         QThread::msleep(chunkSize);
         elapsed += chunkSize;
+        reportTaskProgress("plugins", qreal(elapsed) / duration);
     }
 
     // Example:
@@ -395,6 +473,7 @@ void MainWindow::taskConnectToServices()
     while (elapsed < duration && !m_cancelled) {
         QThread::msleep(chunkSize);
         elapsed += chunkSize;
+        reportTaskProgress("services", qreal(elapsed) / duration);
     }
 
     // Example:
@@ -404,97 +483,117 @@ void MainWindow::taskConnectToServices()
 
 void MainWindow::taskPopulateDataTable()
 {
-    // Heavy task that populates a table with 10,000 rows
-    // This runs in a worker thread and updates the UI in batches
-    // using QMetaObject::invokeMethod to keep the UI responsive.
+    // Heavy task that populates a table with 10,000 rows.
+    // Rows are generated in chunks on every core (global thread pool),
+    // then merged in order on this worker thread and streamed to the UI
+    // through a bounded ring (m_tableQueue) drained once per frame.
 
     const int TOTAL_ROWS = 10000;
-    const int BATCH_SIZE = 500;  // Insert rows in batches of 500
-
-    QStringList statuses = {"Active", "Pending", "Completed", "Failed", "Processing"};
-
-    for (int i = 0; i < TOTAL_ROWS && !m_cancelled; i += BATCH_SIZE) {
-        // Generate a batch of rows in the worker thread
-        QVector<QStringList> batch;
-        batch.reserve(BATCH_SIZE);
-
-        int batchEnd = qMin(i + BATCH_SIZE, TOTAL_ROWS);
-        for (int row = i; row < batchEnd && !m_cancelled; ++row) {
-            // Simulate some CPU-intensive data generation
-            double value = qSin(row * 0.1) * 100 + QRandomGenerator::global()->bounded(50);
-            QString status = statuses[QRandomGenerator::global()->bounded(statuses.size())];
-            QString timestamp = QDateTime::currentDateTime()
-                .addSecs(-QRandomGenerator::global()->bounded(86400))
-                .toString("yyyy-MM-dd hh:mm:ss");
-
-            QStringList rowData;
-            rowData << QString::number(row + 1)
-                    << QString("Item_%1").arg(row + 1, 5, 10, QChar('0'))
-                    << QString::number(value, 'f', 2)
-                    << status
-                    << timestamp;
-
-            batch.append(rowData);
-        }
-
-        // Send the batch to the main thread for UI update
-        // Using QMetaObject::invokeMethod with Qt::BlockingQueuedConnection
-        // ensures we wait for the UI update before generating the next batch,
-        // preventing memory buildup and keeping UI responsive
-        QMetaObject::invokeMethod(this, [this, batch]() {
-            addTableRowsBatch(batch);
-        }, Qt::BlockingQueuedConnection);
-
-        // Small delay between batches to keep UI extra smooth
-        QThread::msleep(10);
+    const int MIN_CHUNK_ROWS = 256;
+    const quint32 SEED = 0x5eed1234;
+
+    // Roughly four chunks per core for load balancing, but not so small
+    // that per-chunk overhead dominates
+    const int threads = qMax(1, QThreadPool::globalInstance()->maxThreadCount());
+    const int chunkRows = qMax(MIN_CHUNK_ROWS, (TOTAL_ROWS + threads * 4 - 1) / (threads * 4));
+    QVector<int> chunkStarts;
+    for (int first = 0; first < TOTAL_ROWS; first += chunkRows) {
+        chunkStarts.append(first);
     }
-}
-
-void MainWindow::addTableRowsBatch(const QVector<QStringList> &rows)
-{
-    // This method runs on the main thread and updates the table
-    // It's called from taskPopulateDataTable via QMetaObject::invokeMethod
 
-    // Temporarily disable updates for faster insertion
-    m_dataTable->setUpdatesEnabled(false);
+    // One clock read for the whole table; rows are offsets from it
+    const qint64 baseTimestamp = QDateTime::currentSecsSinceEpoch();
+
+    std::function<DataTableModel::Rows(int)> generateChunk =
+        [this, chunkRows, baseTimestamp, total = TOTAL_ROWS, seed = SEED](int first) {
+            return DataTableModel::generateRows(first, qMin(chunkRows, total - first), seed,
+                                                baseTimestamp, &m_cancelled);
+        };
+    QFuture<DataTableModel::Rows> chunks = QtConcurrent::mapped(chunkStarts, generateChunk);
+
+    // Fetched once: the reporter is a plain atomic store per call
+    const SplashStepReporter reporter = m_taskReporters.value("datatable");
+
+    // Merge in chunk order: resultAt() waits only for the next chunk, so
+    // early batches reach the UI while later chunks are still generating.
+    // Batches are moved into the ring; push() only waits when the UI is a
+    // full ring behind, and the UI picks the batch size it can absorb.
+    DataTableModel::Rows batch;
+    int merged = 0;
+    for (int chunk = 0; chunk < chunkStarts.size() && !m_cancelled; ++chunk) {
+        const DataTableModel::Rows rows = chunks.resultAt(chunk);
+        if (batch.isEmpty()) {
+            batch = rows;  // Implicitly shared, no copy
+        } else {
+            batch.ids.append(rows.ids);
+            batch.values.append(rows.values);
+            batch.statuses.append(rows.statuses);
+            batch.timestamps.append(rows.timestamps);
+        }
+        merged += rows.size();
 
-    int startRow = m_dataTable->rowCount();
-    m_dataTable->setRowCount(startRow + rows.size());
+        const bool last = (chunk + 1 == chunkStarts.size());
+        if (batch.size() < m_tableQueue.batchRows() && !last) {
+            continue;
+        }
+        if (!m_tableQueue.push(std::move(batch), m_cancelled)) {
+            break;
+        }
+        batch = DataTableModel::Rows();
+        scheduleTableDrain();
 
-    for (int i = 0; i < rows.size(); ++i) {
-        const QStringList &rowData = rows[i];
-        int row = startRow + i;
+        reporter.setFraction(qreal(merged) / TOTAL_ROWS);
+        if (m_progressChannel) {
+            m_progressChannel->postStatus(QString("Populating data table (%L1 / %L2 rows)")
+                                              .arg(merged).arg(TOTAL_ROWS));
+        }
+    }
 
-        for (int col = 0; col < rowData.size() && col < m_dataTable->columnCount(); ++col) {
-            QTableWidgetItem *item = new QTableWidgetItem(rowData[col]);
+    if (m_cancelled) {
+        chunks.cancel();
+    }
+    chunks.waitForFinished();
 
-            // Right-align numeric columns
-            if (col == 0 || col == 2) {
-                item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
-            } else {
-                item->setTextAlignment(Qt::AlignLeft | Qt::AlignVCenter);
-            }
+    // The task is done once the rows are in the table, not just queued
+    m_tableQueue.waitUntilDrained(m_cancelled);
+}
 
-            // Color-code status column
-            if (col == 3) {
-                if (rowData[col] == "Active") {
-                    item->setForeground(QColor("#27ae60"));
-                } else if (rowData[col] == "Failed") {
-                    item->setForeground(QColor("#e74c3c"));
-                } else if (rowData[col] == "Pending") {
-                    item->setForeground(QColor("#f39c12"));
-                } else if (rowData[col] == "Processing") {
-                    item->setForeground(QColor("#3498db"));
-                }
-            }
+void MainWindow::scheduleTableDrain()
+{
+    // One queued drain at a time, whatever the number of pushes
+    if (!m_tableDrainScheduled.exchange(true, std::memory_order_acq_rel)) {
+        QMetaObject::invokeMethod(this, &MainWindow::drainTableRows, Qt::QueuedConnection);
+    }
+}
 
-            m_dataTable->setItem(row, col, item);
+void MainWindow::drainTableRows()
+{
+    // Runs on the main thread. Inserts queued batches until the frame
+    // budget is spent, then yields so the table and splash can paint.
+    m_tableDrainScheduled.store(false, std::memory_order_release);
+
+    QElapsedTimer frame;
+    frame.start();
+    int rows = 0;
+    DataTableModel::Rows batch;
+    while (frame.elapsed() < TABLE_DRAIN_BUDGET_MS && m_tableQueue.tryPop(&batch)) {
+        if (m_dataModel) {
+            m_dataModel->appendRows(batch);
         }
+        rows += batch.size();
     }
 
-    // Re-enable updates and refresh
-    m_dataTable->setUpdatesEnabled(true);
+    // Adapt: a batch should take about a quarter of the budget, so a
+    // frame holds a few batches without overshooting
+    if (rows > 0) {
+        const qint64 nsPerRow = qMax<qint64>(1, frame.nsecsElapsed() / rows);
+        const qint64 targetRows = TABLE_DRAIN_BUDGET_MS * 1000000LL / 4 / nsPerRow;
+        m_tableQueue.setBatchRows(int(qBound<qint64>(MIN_TABLE_BATCH_ROWS, targetRows,
+                                                     MAX_TABLE_BATCH_ROWS)));
+    }
 
-    // Process events to keep UI responsive
-    QApplication::processEvents();
+    if (!m_tableQueue.isEmpty() && !m_tableDrainScheduled.exchange(true, std::memory_order_acq_rel)) {
+        // Timer rather than a posted call: pending paints go first
+        QTimer::singleShot(0, this, &MainWindow::drainTableRows);
+    }
 }
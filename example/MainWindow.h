@@ -9,11 +9,20 @@
 #include <QVBoxLayout>
 #include <QTextEdit>
 #include <QProgressBar>
-#include <QTableWidget>
+#include <QTableView>
 #include <QMutex>
+#include <QHash>
 #include <functional>
 #include <atomic>
 
+#include "StartupTaskScheduler.h"
+#include "SplashStepReporter.h"
+#include "SplashProgressChannel.h"
+#include "DataTableModel.h"
+#include "RowBatchQueue.h"
+
+class SplashStartup;
+
 /**
  * @brief Example MainWindow demonstrating splash screen integration.
  *
@@ -28,13 +37,30 @@ class MainWindow : public QMainWindow
     Q_OBJECT
 
 public:
+    /**
+     * @brief When the widget tree is built
+     */
+    enum class UiConstruction {
+        Immediate,  ///< In the constructor
+        Deferred    ///< By the slices from addConstructionSlices()
+    };
+
     explicit MainWindow(QWidget *parent = nullptr);
+    explicit MainWindow(UiConstruction construction, QWidget *parent = nullptr);
     ~MainWindow() override;
 
+    /**
+     * @brief Queue the widget tree construction on a splash-first startup,
+     * one slice per UI section. Only for UiConstruction::Deferred.
+     */
+    void addConstructionSlices(SplashStartup &startup);
+
     /**
      * @brief Start the initialization process.
-     * This method launches all initialization tasks (both quick and heavy)
-     * in sequence, emitting progress signals for each completed task.
+     * This method hands all initialization tasks (both quick and heavy) to
+     * the startup scheduler, which runs every task as soon as its
+     * dependencies have finished, emitting progress signals as tasks
+     * start and complete.
      */
     void initialize();
 
@@ -43,25 +69,55 @@ public:
      */
     QStringList getInitializationTasks() const;
 
+    /**
+     * @brief Get the unique names of the initialization tasks.
+     */
+    QStringList getInitializationTaskNames() const;
+
     /**
      * @brief Get the number of initialization steps.
      */
     int getInitializationStepCount() const;
 
+    /**
+     * @brief Attach a sub-step progress reporter to a task.
+     * Must be called before initialize(); worker tasks report through it
+     * without posting events to the GUI thread.
+     */
+    void setTaskReporter(const QString &taskName, const SplashStepReporter &reporter);
+
+    /**
+     * @brief Attach the splash progress channel used by worker tasks to
+     * publish detailed status lines without posting events.
+     */
+    void setProgressChannel(std::shared_ptr<SplashProgressChannel> channel);
+
 signals:
     /**
      * @brief Emitted when an initialization step starts.
-     * @param step The current step number (1-based)
+     * @param step The step being worked towards (completed steps + 1).
+     *        Several steps may share the same number when they run in parallel.
      * @param message Description of what's being initialized
      */
     void initializationStepStarted(int step, const QString &message);
 
     /**
      * @brief Emitted when an initialization step completes.
-     * @param step The completed step number (1-based)
+     * @param step Number of completed steps so far (1-based). Monotonic even
+     *        when steps finish out of declaration order.
      */
     void initializationStepCompleted(int step);
 
+    /**
+     * @brief Emitted when a named initialization task starts running.
+     */
+    void initializationTaskStarted(const QString &name);
+
+    /**
+     * @brief Emitted when a named initialization task finishes.
+     */
+    void initializationTaskFinished(const QString &name);
+
     /**
      * @brief Emitted when all initialization is complete.
      */
@@ -73,21 +129,27 @@ signals:
     void initializationFailed(const QString &error);
 
 private slots:
-    void onTaskCompleted();
+    void onTaskStarted(const QString &name, const QString &description);
+    void onTaskFinished(const QString &name, int completed);
+    void onAllTasksFinished();
 
 private:
     void setupUi();
+    void setupFrame();
+    void setupLogView();
+    void setupDataTable();
+    void setupStatusBar();
     void setupInitializationTasks();
-    void runNextTask();
     void logMessage(const QString &message);
     void logTaskStart(const QString &taskName);
-    void logTaskComplete();
+    void logTaskComplete(const QString &taskName);
+    void reportTaskProgress(const QString &taskName, qreal fraction) const;
 
     // ========================================================================
     // INITIALIZATION TASK METHODS
     // Each task method performs a specific initialization operation.
     // Quick tasks run on the main thread.
-    // Heavy tasks run on a worker thread using QtConcurrent.
+    // Heavy tasks run on the startup scheduler thread pool.
     // ========================================================================
 
     // Quick tasks (main thread)
@@ -103,14 +165,16 @@ private:
 
     // Heavy task with UI updates - populates table with 10k rows
     void taskPopulateDataTable();
-    void addTableRowsBatch(const QVector<QStringList> &rows);
+    void scheduleTableDrain();
+    void drainTableRows();
 
     // UI Components
     QWidget *m_centralWidget;
     QVBoxLayout *m_mainLayout;
     QLabel *m_titleLabel;
     QTextEdit *m_logTextEdit;
-    QTableWidget *m_dataTable;
+    QTableView *m_dataTable;
+    DataTableModel *m_dataModel;
     QLabel *m_statusLabel;
 
     // Task management
@@ -119,11 +183,22 @@ private:
         QString description;
         std::function<void()> taskMethod;
         bool isHeavyTask;  // true = run in worker thread
+        QStringList dependencies;  // names of tasks that must finish first
     };
     QVector<InitTask> m_initTasks;
-    int m_currentTaskIndex;
+    StartupTaskScheduler *m_scheduler;
+    QHash<QString, SplashStepReporter> m_taskReporters;  // read-only while tasks run
+    std::shared_ptr<SplashProgressChannel> m_progressChannel;
     std::atomic<bool> m_cancelled;
 
+    // Worker-to-UI row stream for the data table
+    RowBatchQueue m_tableQueue;
+    std::atomic<bool> m_tableDrainScheduled;
+
+    static constexpr int TABLE_DRAIN_BUDGET_MS = 8;  ///< Insertion time per frame
+    static constexpr int MIN_TABLE_BATCH_ROWS = 128;
+    static constexpr int MAX_TABLE_BATCH_ROWS = 16384;
+
     // Threading
     QThread *m_workerThread;
     QMutex m_mutex;
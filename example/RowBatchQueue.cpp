@@ -0,0 +1,63 @@
+#include "RowBatchQueue.h"
+
+RowBatchQueue::RowBatchQueue(int capacity)
+    : m_slots(qMax(1, capacity))
+    , m_free(qMax(1, capacity))
+    , m_head(0)
+    , m_tail(0)
+    , m_batchRows(DEFAULT_BATCH_ROWS)
+{
+}
+
+bool RowBatchQueue::acquireSlots(int count, const std::atomic<bool> &cancelled)
+{
+    while (!m_free.tryAcquire(count, WAIT_SLICE_MS)) {
+        if (cancelled) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RowBatchQueue::push(DataTableModel::Rows &&rows, const std::atomic<bool> &cancelled)
+{
+    if (!acquireSlots(1, cancelled)) {
+        return false;
+    }
+
+    // The acquired slot is free: the consumer is past it
+    const quint64 tail = m_tail.load(std::memory_order_relaxed);
+    m_slots[tail % m_slots.size()] = std::move(rows);
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool RowBatchQueue::tryPop(DataTableModel::Rows *rows)
+{
+    const quint64 head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    DataTableModel::Rows &slot = m_slots[head % m_slots.size()];
+    *rows = std::move(slot);
+    slot = DataTableModel::Rows();
+    m_head.store(head + 1, std::memory_order_release);
+    m_free.release();
+    return true;
+}
+
+bool RowBatchQueue::isEmpty() const
+{
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+}
+
+bool RowBatchQueue::waitUntilDrained(const std::atomic<bool> &cancelled)
+{
+    // Every slot free means every pushed batch has been popped
+    if (!acquireSlots(capacity(), cancelled)) {
+        return false;
+    }
+    m_free.release(capacity());
+    return true;
+}
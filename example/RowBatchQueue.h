@@ -0,0 +1,75 @@
+#ifndef ROWBATCHQUEUE_H
+#define ROWBATCHQUEUE_H
+
+#include <QSemaphore>
+#include <QVector>
+#include <atomic>
+
+#include "DataTableModel.h"
+
+/**
+ * @brief Bounded single-producer/single-consumer ring of row batches.
+ *
+ * Hands DataTableModel::Rows from one worker thread to the GUI thread.
+ * Batches are moved into and out of preallocated slots, so the handoff
+ * never copies row data, and the slot indices are plain atomics.
+ *
+ * The producer blocks only when every slot is full: that backpressure
+ * keeps it at most capacity() batches ahead of what the GUI has
+ * inserted, instead of waiting for a round trip on every batch. The
+ * consumer also publishes the batch size it can absorb per frame
+ * (setBatchRows()), which the producer uses to size the next batches.
+ */
+class RowBatchQueue
+{
+public:
+    static constexpr int DEFAULT_CAPACITY = 8;
+    static constexpr int DEFAULT_BATCH_ROWS = 500;
+
+    explicit RowBatchQueue(int capacity = DEFAULT_CAPACITY);
+
+    RowBatchQueue(const RowBatchQueue &) = delete;
+    RowBatchQueue &operator=(const RowBatchQueue &) = delete;
+
+    int capacity() const { return static_cast<int>(m_slots.size()); }
+
+    /**
+     * @brief Move @p rows into the next slot, waiting while the queue is
+     * full. Producer side only.
+     * @return false if @p cancelled was set before a slot became free
+     */
+    bool push(DataTableModel::Rows &&rows, const std::atomic<bool> &cancelled);
+
+    /**
+     * @brief Move the oldest batch into @p rows. Consumer side only, never waits.
+     * @return false if the queue is empty
+     */
+    bool tryPop(DataTableModel::Rows *rows);
+
+    bool isEmpty() const;
+
+    /**
+     * @brief Wait until the consumer has taken every batch. Producer side only.
+     * @return false if @p cancelled was set first
+     */
+    bool waitUntilDrained(const std::atomic<bool> &cancelled);
+
+    /**
+     * @brief Rows per batch the consumer wants next (adaptive)
+     */
+    int batchRows() const { return m_batchRows.load(std::memory_order_relaxed); }
+    void setBatchRows(int rows) { m_batchRows.store(rows, std::memory_order_relaxed); }
+
+private:
+    bool acquireSlots(int count, const std::atomic<bool> &cancelled);
+
+    QVector<DataTableModel::Rows> m_slots;
+    QSemaphore m_free;                  ///< Empty slots; the producer waits on it
+    std::atomic<quint64> m_head;        ///< Next slot to pop (written by the consumer)
+    std::atomic<quint64> m_tail;        ///< Next slot to push (written by the producer)
+    std::atomic<int> m_batchRows;
+
+    static constexpr int WAIT_SLICE_MS = 20;  ///< Cancellation check interval
+};
+
+#endif // ROWBATCHQUEUE_H
@@ -3,6 +3,8 @@
 #include <QDebug>
 
 #include "SplashScreenWidget.h"
+#include "SplashSnapshotWindow.h"
+#include "SplashStartup.h"
 #include "MainWindow.h"
 
 /**
@@ -22,17 +24,30 @@ int main(int argc, char *argv[])
 {
     QApplication app(argc, argv);
 
-    // Set application info
+    // Set application info (first: the snapshot path depends on it)
     app.setApplicationName("Qt Splash Screen Demo");
     app.setApplicationVersion("1.0.0");
     app.setOrganizationName("GeekyTech");
 
+    // Startups faster than this never show a splash
+    const int showDelayMs = 400;
+
+    // Last run's splash, mapped into a raw window before any widget exists;
+    // the splash presents it once the show delay has passed (skipped when
+    // the last startup was faster than the delay)
+    SplashSnapshotWindow *snapshot = SplashSnapshotWindow::loadSnapshot(
+        SplashSnapshotWindow::defaultPath(), showDelayMs);
+
     // ==========================================================================
     // SPLASH SCREEN SETUP
     // ==========================================================================
 
     SplashScreenWidget splash;
 
+    // Collect all settings and apply them in one pass: one polish, one
+    // rasterization per logo at its final size, one layout
+    splash.beginUpdate();
+
     // Configure appearance
     splash.setWindowSize(QSize(500, 400));
     splash.setLogoSize(QSize(120, 120));
@@ -44,76 +59,127 @@ int main(int argc, char *argv[])
     splash.setCompanyName("Procter");
     splash.setBackgroundColor(QColor("#f7f5f2"));
 
-    // Load custom logo (SVG)
-    QString logoPath = QDir::currentPath() + "/resources/icons/app_logo.svg";
-    splash.setLogoPath(logoPath);
-
-    // Load custom stylesheet
-    QString stylePath = QDir::currentPath() + "/resources/style/light.qss";
-    splash.setStyleSheetPath(stylePath);
-
-    // Company logo placeholder (replace with your SVG)
-    QString companyLogoPath = QDir::currentPath() + "/resources/icons/procter_logo.svg";
-    splash.setCompanyLogoPath(companyLogoPath);
+    // Preferred: one mapped file generated at build time (logos already
+    // rasterized, theme already pruned)
     splash.setCompanyLogoSize(QSize(110, 30));
+    const QString bundlePath = QCoreApplication::applicationDirPath() + "/splash.bundle";
+    if (!splash.setAssetBundle(bundlePath)) {
+        // Fallback: assets load on a worker thread; the splash shows
+        // placeholders and swaps them in, so slow disks never delay the
+        // first frame
+        QString logoPath = QDir::currentPath() + "/resources/icons/app_logo.svg";
+        splash.setLogoPathAsync(logoPath);
+
+        // Load custom stylesheet
+        QString stylePath = QDir::currentPath() + "/resources/style/light.qss";
+        splash.setStyleSheetPathAsync(stylePath);
+
+        // Company logo placeholder (replace with your SVG)
+        QString companyLogoPath = QDir::currentPath() + "/resources/icons/procter_logo.svg";
+        splash.setCompanyLogoPathAsync(companyLogoPath);
+    }
+    splash.endUpdate();
 
     // Configure timing
-    splash.setMinimumDisplayDuration(3000);  // Minimum 3 seconds visible
+    splash.setShowDelay(showDelayMs);
+    splash.setMinimumDisplayDuration(3000);  // Once shown, at least 3 seconds visible
+    splash.setClosingDelay(200);             // Time the "Ready!" state stays up
 
-    // ==========================================================================
-    // MAIN WINDOW SETUP
-    // ==========================================================================
+    // The splash lives on the stack for the whole session: drop its
+    // widgets, rasters and window once the main window has taken over
+    splash.setReleaseResourcesOnFinish(true);
 
-    MainWindow mainWindow;
-
-    // Configure splash for determinate progress based on MainWindow tasks
-    // The splash screen will know exactly how many tasks to expect
-    int totalSteps = mainWindow.getInitializationStepCount();
-    splash.setTotalSteps(totalSteps);
-    splash.setProgressMode(SplashScreenWidget::ProgressMode::Determinate);
+    // Apply status/progress changes once per frame instead of pumping
+    // the event loop from inside every signal handler
+    splash.setUpdateMode(SplashScreenWidget::UpdateMode::FrameCoalesced);
 
     // ==========================================================================
-    // SIGNAL CONNECTIONS
+    // MAIN WINDOW SETUP
     // ==========================================================================
 
-    // Connect MainWindow initialization progress to splash screen
-    QObject::connect(&mainWindow, &MainWindow::initializationStepStarted,
-                     [&splash](int step, const QString &message) {
-                         splash.setProgress(step);
-                         splash.setStatusMessage(message);
-                     });
-
-    // When initialization completes, signal splash to finish
-    QObject::connect(&mainWindow, &MainWindow::initializationComplete,
-                     [&splash]() {
-                         splash.finishSplash();
+    // Splash first: the main window is created after the splash is on
+    // screen and its UI is built in slices between splash frames
+    SplashStartup startup(&splash);
+    startup.setMainWindowFactory([&startup]() {
+        auto *window = new MainWindow(MainWindow::UiConstruction::Deferred);
+        window->addConstructionSlices(startup);
+        return window;
+    });
+
+    QObject::connect(&startup, &SplashStartup::mainWindowCreated,
+                     [&splash, &startup](QWidget *window) {
+        auto *mainWindow = static_cast<MainWindow *>(window);
+
+        // Configure splash for determinate progress based on MainWindow tasks
+        // The splash screen will know exactly how many tasks to expect
+        int totalSteps = mainWindow->getInitializationStepCount();
+        splash.setTotalSteps(totalSteps);
+        splash.setProgressMode(SplashScreenWidget::ProgressMode::Determinate);
+
+        // Named steps let the bar advance by expected duration, learned from
+        // the timings of previous runs
+        splash.setSteps(mainWindow->getInitializationTaskNames());
+        splash.setShowRemainingTime(true);
+
+        // Long tasks report progress inside their step from worker threads
+        for (const QString &taskName : mainWindow->getInitializationTaskNames()) {
+            mainWindow->setTaskReporter(taskName, splash.stepReporter(taskName));
+        }
+        mainWindow->setProgressChannel(splash.progressChannel());
+
+        // ======================================================================
+        // SIGNAL CONNECTIONS
+        // ======================================================================
+
+        // Connect MainWindow initialization progress to splash screen.
+        // Tasks run in parallel, so the status line follows whichever task
+        // started last while the bar follows the expected time of each task.
+        QObject::connect(mainWindow, &MainWindow::initializationStepStarted,
+                         [&splash](int /* step */, const QString &message) {
+                             splash.setStatusMessage(message);
+                         });
+
+        QObject::connect(mainWindow, &MainWindow::initializationTaskStarted,
+                         &splash, &SplashScreenWidget::beginStep);
+
+        QObject::connect(mainWindow, &MainWindow::initializationTaskFinished,
+                         &splash, &SplashScreenWidget::endStep);
+
+        // When initialization completes, render the main window's first
+        // frame offscreen, then close the splash. The startup helper shows
+        // the main window on splashFinished.
+        QObject::connect(mainWindow, &MainWindow::initializationComplete,
+                         &startup, &SplashStartup::finish);
+
+        // Handle initialization errors
+        QObject::connect(mainWindow, &MainWindow::initializationFailed,
+                         [&splash, &startup](const QString &error) {
+                             splash.setStatusMessage("Error: " + error);
+                             startup.finish();
+                         });
+    });
+
+    QObject::connect(&startup, &SplashStartup::handoffCompleted,
+                     [](qint64 latencyUs) {
+                         qDebug() << "Main window on screen" << latencyUs / 1000.0
+                                  << "ms after the splash finished";
                      });
 
-    // Handle initialization errors
-    QObject::connect(&mainWindow, &MainWindow::initializationFailed,
-                     [&splash](const QString &error) {
-                         splash.setStatusMessage("Error: " + error);
-                         splash.finishSplash();
-                     });
-
-    // When splash is finished, show main window
-    QObject::connect(&splash, &SplashScreenWidget::splashFinished,
-                     [&mainWindow]() {
-                         mainWindow.show();
-                         mainWindow.raise();
-                         mainWindow.activateWindow();
+    // Start MainWindow initialization once its UI exists
+    // Independent tasks run concurrently; heavy tasks use a thread pool
+    QObject::connect(&startup, &SplashStartup::mainWindowReady,
+                     [](QWidget *window) {
+                         static_cast<MainWindow *>(window)->initialize();
                      });
 
     // ==========================================================================
     // START APPLICATION
     // ==========================================================================
 
-    // Show splash and start initialization
-    splash.startSplash();
-
-    // Start MainWindow initialization
-    // Tasks run sequentially, with heavy tasks in background threads
-    mainWindow.initialize();
+    // Show splash, then build the main window; the live splash replaces
+    // the snapshot once it is fully composed
+    splash.adoptSnapshot(snapshot);
+    startup.start();
 
     return app.exec();
 }
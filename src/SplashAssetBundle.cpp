@@ -0,0 +1,234 @@
+#include "SplashAssetBundle.h"
+#include <QJsonDocument>
+#include <QSaveFile>
+#include <QDebug>
+#include <cstring>
+
+namespace {
+constexpr char BUNDLE_MAGIC[4] = {'S', 'P', 'L', 'B'};
+
+qint64 alignUp(qint64 value, qint64 alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+}
+
+SplashAssetBundle::SplashAssetBundle()
+    : m_map(nullptr)
+    , m_mappedSize(0)
+{
+}
+
+SplashAssetBundle::~SplashAssetBundle()
+{
+    close();
+}
+
+bool SplashAssetBundle::open(const QString &path)
+{
+    close();
+
+    m_file.setFileName(path);
+    if (!m_file.open(QFile::ReadOnly)) {
+        return false;
+    }
+    const qint64 size = m_file.size();
+    if (size < static_cast<qint64>(sizeof(FileHeader))) {
+        m_file.close();
+        return false;
+    }
+    m_map = m_file.map(0, size);
+    if (!m_map) {
+        m_file.close();
+        return false;
+    }
+    m_mappedSize = size;
+
+    // Validate the header and every record before handing out views
+    FileHeader header;
+    std::memcpy(&header, m_map, sizeof(header));
+    const qint64 tableEnd = static_cast<qint64>(sizeof(FileHeader))
+                            + static_cast<qint64>(header.entryCount) * sizeof(Record);
+    bool valid = std::memcmp(header.magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC)) == 0
+                 && header.version == FORMAT_VERSION
+                 && tableEnd <= size;
+    for (quint32 i = 0; valid && i < header.entryCount; ++i) {
+        const Record &record = records()[i];
+        valid = record.name[MAX_NAME_LENGTH] == '\0'
+                && record.offset >= static_cast<quint64>(tableEnd)
+                && record.offset % PAYLOAD_ALIGNMENT == 0
+                && record.size <= static_cast<quint64>(size)
+                && record.offset <= static_cast<quint64>(size) - record.size;
+        if (valid && record.type == ImageEntry) {
+            valid = record.dprMilli > 0
+                    && record.bytesPerLine >= record.width * 4
+                    && static_cast<quint64>(record.bytesPerLine) * record.height <= record.size;
+        }
+    }
+
+    if (!valid) {
+        qWarning() << "SplashScreen: Invalid asset bundle:" << path;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void SplashAssetBundle::close()
+{
+    if (m_map) {
+        m_file.unmap(m_map);
+        m_map = nullptr;
+    }
+    m_mappedSize = 0;
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+}
+
+const SplashAssetBundle::Record *SplashAssetBundle::records() const
+{
+    return reinterpret_cast<const Record *>(m_map + sizeof(FileHeader));
+}
+
+quint32 SplashAssetBundle::recordCount() const
+{
+    if (!m_map) {
+        return 0;
+    }
+    FileHeader header;
+    std::memcpy(&header, m_map, sizeof(header));
+    return header.entryCount;
+}
+
+bool SplashAssetBundle::contains(const QString &name) const
+{
+    const QByteArray key = name.toUtf8();
+    const quint32 count = recordCount();
+    for (quint32 i = 0; i < count; ++i) {
+        if (key == records()[i].name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+QImage SplashAssetBundle::image(const QString &name, qreal devicePixelRatio) const
+{
+    const QByteArray key = name.toUtf8();
+    const quint32 wanted = static_cast<quint32>(qRound(devicePixelRatio * 1000));
+    const Record *best = nullptr;
+
+    const quint32 count = recordCount();
+    for (quint32 i = 0; i < count; ++i) {
+        const Record &record = records()[i];
+        if (record.type != ImageEntry || key != record.name) {
+            continue;
+        }
+        // Prefer exact, then the smallest larger ratio, then the largest
+        if (!best) {
+            best = &record;
+        } else if (record.dprMilli >= wanted) {
+            if (best->dprMilli < wanted || record.dprMilli < best->dprMilli) {
+                best = &record;
+            }
+        } else if (best->dprMilli < wanted && record.dprMilli > best->dprMilli) {
+            best = &record;
+        }
+    }
+    if (!best) {
+        return QImage();
+    }
+
+    // Read-only view: the const buffer makes any write (bits(), painting,
+    // in-place conversion) detach into a copy instead of touching the
+    // read-only mapping
+    QImage view(static_cast<const uchar *>(m_map + best->offset), static_cast<int>(best->width), static_cast<int>(best->height),
+                static_cast<qsizetype>(best->bytesPerLine), QImage::Format_ARGB32_Premultiplied);
+    view.setDevicePixelRatio(best->dprMilli / 1000.0);
+    return view;
+}
+
+QByteArray SplashAssetBundle::data(const QString &name) const
+{
+    const QByteArray key = name.toUtf8();
+    const quint32 count = recordCount();
+    for (quint32 i = 0; i < count; ++i) {
+        const Record &record = records()[i];
+        if (record.type == DataEntry && key == record.name) {
+            return QByteArray::fromRawData(reinterpret_cast<const char *>(m_map + record.offset),
+                                           static_cast<qsizetype>(record.size));
+        }
+    }
+    return QByteArray();
+}
+
+QJsonObject SplashAssetBundle::metadata() const
+{
+    return QJsonDocument::fromJson(data("metadata")).object();
+}
+
+bool SplashAssetBundle::write(const QString &path, const QVector<Entry> &entries)
+{
+    QVector<Record> table;
+    QVector<QImage> images;
+    qint64 offset = alignUp(static_cast<qint64>(sizeof(FileHeader))
+                            + static_cast<qint64>(entries.size()) * sizeof(Record),
+                            PAYLOAD_ALIGNMENT);
+
+    for (const Entry &entry : entries) {
+        const QByteArray name = entry.name.toUtf8();
+        if (name.isEmpty() || name.size() > MAX_NAME_LENGTH) {
+            qWarning() << "SplashScreen: Invalid bundle entry name:" << entry.name;
+            return false;
+        }
+
+        Record record;
+        std::memset(&record, 0, sizeof(record));
+        std::memcpy(record.name, name.constData(), static_cast<size_t>(name.size()));
+        record.offset = static_cast<quint64>(offset);
+
+        if (!entry.image.isNull()) {
+            const QImage image = entry.image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+            record.type = ImageEntry;
+            record.width = static_cast<quint32>(image.width());
+            record.height = static_cast<quint32>(image.height());
+            record.bytesPerLine = static_cast<quint32>(image.bytesPerLine());
+            record.dprMilli = static_cast<quint32>(qRound(image.devicePixelRatio() * 1000));
+            record.size = static_cast<quint64>(image.sizeInBytes());
+            images.append(image);
+        } else {
+            record.type = DataEntry;
+            record.size = static_cast<quint64>(entry.data.size());
+            images.append(QImage());
+        }
+        table.append(record);
+        offset = alignUp(offset + static_cast<qint64>(record.size), PAYLOAD_ALIGNMENT);
+    }
+
+    QSaveFile file(path);
+    if (!file.open(QFile::WriteOnly)) {
+        return false;
+    }
+
+    FileHeader header;
+    std::memcpy(header.magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC));
+    header.version = FORMAT_VERSION;
+    header.entryCount = static_cast<quint32>(table.size());
+    header.reserved = 0;
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(table.constData()),
+               static_cast<qint64>(table.size()) * sizeof(Record));
+
+    for (int i = 0; i < table.size(); ++i) {
+        const QByteArray padding(static_cast<int>(table[i].offset - file.pos()), '\0');
+        file.write(padding);
+        if (table[i].type == ImageEntry) {
+            file.write(reinterpret_cast<const char *>(images[i].constBits()),
+                       static_cast<qint64>(table[i].size));
+        } else {
+            file.write(entries[i].data);
+        }
+    }
+    return file.commit();
+}
@@ -0,0 +1,113 @@
+#ifndef SPLASHASSETBUNDLE_H
+#define SPLASHASSETBUNDLE_H
+
+#include <QString>
+#include <QImage>
+#include <QByteArray>
+#include <QJsonObject>
+#include <QVector>
+#include <QFile>
+
+/**
+ * @brief Single-file, memory-mapped container for splash assets.
+ *
+ * A bundle is produced at build time (see tools/SplashBundleTool.cpp) and
+ * holds the logos pre-rasterized at several device pixel ratios, the
+ * pruned stylesheet and a JSON metadata block. Opening it costs one file
+ * open and one mmap; images returned by image() are read-only QImage
+ * views over the mapping, so no pixel is copied or decoded.
+ *
+ * Layout (host byte order; bundles are build artifacts for one target):
+ * - FileHeader
+ * - Record table, one per entry
+ * - Entry payloads, each aligned to PAYLOAD_ALIGNMENT
+ *
+ * The bundle must outlive every image and data view taken from it.
+ */
+class SplashAssetBundle
+{
+public:
+    static constexpr quint32 FORMAT_VERSION = 1;
+    static constexpr int MAX_NAME_LENGTH = 47;
+    static constexpr int PAYLOAD_ALIGNMENT = 64;
+
+    /**
+     * @brief Entry to write: either an image or raw data
+     */
+    struct Entry {
+        QString name;
+        QImage image;     ///< Stored as premultiplied ARGB32 with its DPR
+        QByteArray data;  ///< Used when image is null
+    };
+
+    SplashAssetBundle();
+    ~SplashAssetBundle();
+
+    SplashAssetBundle(const SplashAssetBundle &) = delete;
+    SplashAssetBundle &operator=(const SplashAssetBundle &) = delete;
+
+    bool open(const QString &path);
+    void close();
+    bool isOpen() const { return m_map != nullptr; }
+    QString fileName() const { return m_file.fileName(); }
+    qint64 mappedSize() const { return m_mappedSize; }
+
+    bool contains(const QString &name) const;
+
+    /**
+     * @brief Zero-copy view of the image entry @p name closest to
+     * @p devicePixelRatio (exact match, else the next larger, else the
+     * largest available). Null if there is no such entry.
+     */
+    QImage image(const QString &name, qreal devicePixelRatio) const;
+
+    /**
+     * @brief Zero-copy view of a data entry (QByteArray::fromRawData).
+     */
+    QByteArray data(const QString &name) const;
+
+    /**
+     * @brief Contents of the "metadata" JSON entry
+     */
+    QJsonObject metadata() const;
+
+    /**
+     * @brief Write a bundle. Several image entries may share a name when
+     * their device pixel ratios differ.
+     */
+    static bool write(const QString &path, const QVector<Entry> &entries);
+
+private:
+    enum EntryType : quint32 {
+        ImageEntry = 0,
+        DataEntry = 1
+    };
+
+    struct FileHeader {
+        char magic[4];
+        quint32 version;
+        quint32 entryCount;
+        quint32 reserved;
+    };
+
+    struct Record {
+        quint32 type;
+        quint32 width;
+        quint32 height;
+        quint32 bytesPerLine;
+        quint32 dprMilli;  ///< Device pixel ratio * 1000
+        quint32 reserved;
+        quint64 offset;
+        quint64 size;
+        char name[MAX_NAME_LENGTH + 1];
+    };
+
+    const Record *records() const;
+    quint32 recordCount() const;
+
+    QFile m_file;
+    uchar *m_map;
+    qint64 m_mappedSize;
+};
+
+#endif // SPLASHASSETBUNDLE_H
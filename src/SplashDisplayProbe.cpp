@@ -0,0 +1,72 @@
+#include "SplashDisplayProbe.h"
+#include <QGuiApplication>
+#include <QByteArray>
+#include <QString>
+
+#ifdef SPLASH_HAVE_X11
+#include <X11/Xlib.h>
+#endif
+
+namespace {
+struct PlatformTraits {
+    const char *name;
+    bool composited;
+    bool constrained;
+};
+
+// Platform plugins that differ from a desktop session; all others
+// composite (xcb is probed) and paint at full speed. eglfs draws one
+// fullscreen surface without a compositor, but on the GPU.
+const PlatformTraits PLATFORMS[] = {
+    {"vnc", false, true},
+    {"linuxfb", false, true},
+    {"eglfs", false, false},
+    {"offscreen", false, true},
+    {"minimal", false, true},
+};
+
+const PlatformTraits *platformTraits()
+{
+    const QString platform = QGuiApplication::platformName();
+    for (const PlatformTraits &traits : PLATFORMS) {
+        if (platform == QLatin1String(traits.name)) {
+            return &traits;
+        }
+    }
+    return nullptr;
+}
+}
+
+bool SplashDisplayProbe::hasCompositor()
+{
+    const QString platform = QGuiApplication::platformName();
+    if (platform == "xcb") {
+#if defined(SPLASH_HAVE_X11) && QT_CONFIG(xcb)
+        auto *x11 = qGuiApp->nativeInterface<QNativeInterface::QX11Application>();
+        Display *display = x11 ? x11->display() : nullptr;
+        if (display) {
+            const QByteArray selection = "_NET_WM_CM_S" + QByteArray::number(DefaultScreen(display));
+            const Atom atom = XInternAtom(display, selection.constData(), False);
+            return XGetSelectionOwner(display, atom) != 0;
+        }
+#endif
+        return true;
+    }
+
+    const PlatformTraits *traits = platformTraits();
+    return !traits || traits->composited;
+}
+
+bool SplashDisplayProbe::isConstrained()
+{
+    // Remote sessions and software GL: start one tier down
+    const PlatformTraits *traits = platformTraits();
+    if (traits && traits->constrained) {
+        return true;
+    }
+    if (qEnvironmentVariable("SESSIONNAME").startsWith("RDP-", Qt::CaseInsensitive)) {
+        return true;
+    }
+    return qEnvironmentVariableIntValue("LIBGL_ALWAYS_SOFTWARE") == 1
+           || qEnvironmentVariable("QT_OPENGL") == "software";
+}
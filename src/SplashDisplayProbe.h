@@ -0,0 +1,31 @@
+#ifndef SPLASHDISPLAYPROBE_H
+#define SPLASHDISPLAYPROBE_H
+
+/**
+ * @brief Queries about the display the splash is shown on.
+ *
+ * Kept in its own translation unit so platform headers (Xlib defines
+ * macros such as Expose and Status) never leak into widget code.
+ */
+class SplashDisplayProbe
+{
+public:
+    /**
+     * @brief Whether per-pixel window translucency is composited.
+     *
+     * Windows, macOS and Wayland always composite. On X11 the probe checks
+     * for an owner of the _NET_WM_CM_Sn selection (built with X11 only;
+     * otherwise a compositor is assumed). Framebuffer, VNC and offscreen
+     * platforms report false.
+     */
+    static bool hasCompositor();
+
+    /**
+     * @brief Whether painting is likely slow: remote (VNC, RDP), software
+     * GL, framebuffer or offscreen platforms. The splash starts one render
+     * tier down there.
+     */
+    static bool isConstrained();
+};
+
+#endif // SPLASHDISPLAYPROBE_H
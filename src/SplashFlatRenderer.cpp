@@ -0,0 +1,378 @@
+#include "SplashFlatRenderer.h"
+#include "SplashLayoutMetrics.h"
+#include "SplashStyleSheetCache.h"
+#include <QRegularExpression>
+#include <QHash>
+#include <QFontMetrics>
+#include <QLinearGradient>
+#include <QStringList>
+#include <QtMath>
+
+using namespace SplashLayoutMetrics;
+
+SplashFlatRenderer::SplashFlatRenderer()
+    : m_windowSize(450, 350)
+    , m_logoSize(128, 128)
+    , m_companyLogoSize(90, 26)
+    , m_maximum(100)
+    , m_value(0)
+    , m_indeterminate(true)
+    , m_complete(false)
+    , m_flat(false)
+    , m_chunkPosition(0.0)
+    , m_easing(QEasingCurve::InOutSine)
+    , m_trackColor(17, 169, 157, 31)
+    , m_chunkColor(0x11, 0xa9, 0x9d)
+    , m_chunkHighlightColor(0x33, 0xd4, 0xc8)
+{
+    // Same typography as resources/style/light.qss
+    const QStringList display = {"Gotham", "Avenir Next", "Futura", "Segoe UI Semibold"};
+    m_appName.font = makeFont(display, 28, QFont::Bold, 1.5);
+    m_appName.color = QColor(0x0b, 0x13, 0x20);
+    m_appVersion.font = makeFont(display, 11, QFont::DemiBold, 2.0);
+    m_appVersion.color = QColor(0x5b, 0x67, 0x7a);
+    m_companyName.font = makeFont(display, 11, QFont::Bold, 3.0);
+    m_companyName.color = QColor(0x0b, 0x13, 0x20);
+    m_status.font = makeFont({"Avenir Next", "Segoe UI"}, 12, QFont::Normal, 0.6);
+    m_status.color = QColor(0x5b, 0x67, 0x7a);
+
+    m_appName.text = "Application";
+    m_appVersion.text = "v1.0.0";
+    m_companyName.text = "Company";
+    updateLayout();
+}
+
+QFont SplashFlatRenderer::makeFont(const QStringList &families, int pixelSize, int weight,
+                                   qreal spacing)
+{
+    QFont font;
+    font.setFamilies(families);
+    font.setPixelSize(pixelSize);
+    font.setWeight(static_cast<QFont::Weight>(weight));
+    font.setLetterSpacing(QFont::AbsoluteSpacing, spacing);
+    return font;
+}
+
+QColor SplashFlatRenderer::parseColor(const QString &value)
+{
+    // QColor parses names and #hex; QSS also allows rgb()/rgba() with a
+    // 0-1 or 0-255 alpha
+    static const QRegularExpression function(
+        QStringLiteral("^rgba?\\(\\s*([\\d.]+)\\s*,\\s*([\\d.]+)\\s*,\\s*([\\d.]+)\\s*(?:,\\s*([\\d.]+%?)\\s*)?\\)$"));
+    const QString trimmed = value.trimmed();
+    const QRegularExpressionMatch match = function.match(trimmed);
+    if (!match.hasMatch()) {
+        return QColor(trimmed);
+    }
+
+    QColor color(qBound(0, match.captured(1).toInt(), 255),
+                 qBound(0, match.captured(2).toInt(), 255),
+                 qBound(0, match.captured(3).toInt(), 255));
+    QString alpha = match.captured(4);
+    if (!alpha.isEmpty()) {
+        if (alpha.endsWith('%')) {
+            alpha.chop(1);
+            color.setAlphaF(qBound(0.0, alpha.toDouble() / 100.0, 1.0));
+        } else if (alpha.contains('.') || alpha.toDouble() <= 1.0) {
+            color.setAlphaF(qBound(0.0, alpha.toDouble(), 1.0));
+        } else {
+            color.setAlpha(qBound(0, alpha.toInt(), 255));
+        }
+    }
+    return color;
+}
+
+void SplashFlatRenderer::applyStyleSheet(const QString &styleSheet)
+{
+    // Minified rules: one "selectors{declarations}" per line
+    const SplashStyleSheetCache::Scope scope = {
+        {},
+        {"splashAppName", "splashAppVersion", "splashCompanyName", "splashStatusLabel",
+         "splashProgressIndicator"}};
+    bool parsed = false;
+    const QString rules = SplashStyleSheetCache::prune(styleSheet, scope, &parsed);
+    if (!parsed) {
+        return;  // Not plain rules: keep the current colors
+    }
+
+    const QHash<QString, QColor *> textColors = {
+        {"#splashAppName", &m_appName.color},
+        {"#splashAppVersion", &m_appVersion.color},
+        {"#splashCompanyName", &m_companyName.color},
+        {"#splashStatusLabel", &m_status.color},
+    };
+    const QHash<QString, QColor *> indicatorColors = {
+        {"qproperty-trackColor", &m_trackColor},
+        {"qproperty-chunkColor", &m_chunkColor},
+        {"qproperty-chunkHighlightColor", &m_chunkHighlightColor},
+    };
+
+    for (const QString &rule : rules.split('\n', Qt::SkipEmptyParts)) {
+        const int open = rule.indexOf('{');
+        if (open < 0 || !rule.endsWith('}')) {
+            continue;
+        }
+        const QStringList selectors = rule.left(open).split(',');
+        const QStringList declarations = rule.mid(open + 1, rule.size() - open - 2).split(';');
+        for (const QString &declaration : declarations) {
+            const int colon = declaration.indexOf(':');
+            const QString property = declaration.left(colon);
+            const QColor color = parseColor(declaration.mid(colon + 1));
+            if (colon <= 0 || !color.isValid()) {
+                continue;
+            }
+            for (const QString &selector : selectors) {
+                // Only plain id rules: pseudo-states do not exist here
+                if (property == QLatin1String("color") && textColors.contains(selector)) {
+                    *textColors.value(selector) = color;
+                } else if (selector == QLatin1String("#splashProgressIndicator")
+                           && indicatorColors.contains(property)) {
+                    *indicatorColors.value(property) = color;
+                }
+            }
+        }
+    }
+}
+
+void SplashFlatRenderer::setWindowSize(const QSize &size)
+{
+    m_windowSize = size;
+    updateLayout();
+}
+
+void SplashFlatRenderer::setLogoSize(const QSize &size)
+{
+    m_logoSize = size;
+    updateLayout();
+}
+
+void SplashFlatRenderer::setCompanyLogoSize(const QSize &size)
+{
+    m_companyLogoSize = size;
+    updateLayout();
+}
+
+void SplashFlatRenderer::setLogo(const QImage &logo)
+{
+    m_logo = logo;
+}
+
+void SplashFlatRenderer::setCompanyLogo(const QPixmap &pixmap)
+{
+    m_companyLogo = pixmap;
+}
+
+void SplashFlatRenderer::setAppName(const QString &name)
+{
+    prepareText(m_appName, name);
+}
+
+void SplashFlatRenderer::setAppVersion(const QString &version)
+{
+    prepareText(m_appVersion, version);
+}
+
+void SplashFlatRenderer::setCompanyName(const QString &name)
+{
+    prepareText(m_companyName, name);
+}
+
+bool SplashFlatRenderer::setStatus(const QString &status)
+{
+    if (status == m_status.text) {
+        return false;
+    }
+    prepareText(m_status, status);
+    return true;
+}
+
+bool SplashFlatRenderer::setMaximum(int maximum)
+{
+    maximum = qMax(1, maximum);
+    if (maximum == m_maximum) {
+        return false;
+    }
+    m_maximum = maximum;
+    return !m_indeterminate;
+}
+
+bool SplashFlatRenderer::setValue(int value)
+{
+    if (value == m_value) {
+        return false;
+    }
+    m_value = value;
+    return !m_indeterminate;
+}
+
+void SplashFlatRenderer::setIndeterminate(bool indeterminate)
+{
+    m_indeterminate = indeterminate;
+    m_complete = false;
+}
+
+void SplashFlatRenderer::setComplete(bool complete)
+{
+    m_complete = complete;
+}
+
+void SplashFlatRenderer::setFlat(bool flat)
+{
+    m_flat = flat;
+}
+
+QRectF SplashFlatRenderer::chunkRect(qreal position) const
+{
+    const qreal chunkWidth = m_progressRect.width() * CHUNK_FRACTION;
+    const qreal travel = m_progressRect.width() - chunkWidth;
+    return QRectF(m_progressRect.x() + travel * position, m_progressRect.y(),
+                  chunkWidth, m_progressRect.height());
+}
+
+QRect SplashFlatRenderer::setChunkPosition(qreal position)
+{
+    const QRectF before = chunkRect(m_chunkPosition);
+    m_chunkPosition = position;
+    const QRectF after = chunkRect(m_chunkPosition);
+
+    // Only what the chunk covered and now covers (+1 px for AA)
+    return before.united(after).toAlignedRect().adjusted(-1, 0, 1, 0).intersected(m_progressRect);
+}
+
+QRect SplashFlatRenderer::advanceChunk(qint64 elapsedMs)
+{
+    const qint64 period = 2 * static_cast<qint64>(CYCLE_MS);
+    const qreal phase = static_cast<qreal>(elapsedMs % period) / CYCLE_MS;
+    const qreal t = (phase <= 1.0) ? phase : 2.0 - phase;
+    return setChunkPosition(m_easing.valueForProgress(t));
+}
+
+QRect SplashFlatRenderer::companyLogoRect() const
+{
+    if (m_companyLogo.isNull()) {
+        return QRect(m_companyLogoSlot.topLeft(), QSize());
+    }
+    // Centered in its slot, like the label in widget mode
+    const QSize imageSize = m_companyLogo.deviceIndependentSize().toSize();
+    const QPoint inset((m_companyLogoSlot.width() - imageSize.width()) / 2,
+                       (m_companyLogoSlot.height() - imageSize.height()) / 2);
+    return QRect(m_companyLogoSlot.topLeft() + inset, imageSize);
+}
+
+void SplashFlatRenderer::updateLayout()
+{
+    const QRect content = QRect(QPoint(0, 0), m_windowSize)
+                              .adjusted(MARGIN_LEFT, MARGIN_TOP, -MARGIN_RIGHT, -MARGIN_BOTTOM);
+
+    // Label paddings from the theme: name 6/2 px, version 0/8 px
+    const int nameHeight = QFontMetrics(m_appName.font).height() + 8;
+    const int versionHeight = QFontMetrics(m_appVersion.font).height() + 8;
+    const int companyNameHeight = QFontMetrics(m_companyName.font).height();
+    const int progressHeight = BAR_HEIGHT + PROGRESS_SPACING + STATUS_HEIGHT;
+    const int companyHeight = m_companyLogoSize.height() + COMPANY_SPACING + companyNameHeight;
+
+    // The stretches share the free space, as in the widget layout
+    const int fixed = m_logoSize.height() + nameHeight + versionHeight + progressHeight
+                      + companyHeight + 2 * SPACING;
+    const qreal unit = qMax(0, content.height() - fixed)
+                       / qreal(TOP_STRETCH + PROGRESS_STRETCH + FOOTER_STRETCH);
+
+    int y = content.top() + qRound(TOP_STRETCH * unit);
+    m_logoRect = QRect(content.center().x() - m_logoSize.width() / 2, y,
+                       m_logoSize.width(), m_logoSize.height());
+    y += m_logoSize.height() + SPACING;
+    m_appName.rect = QRect(content.left(), y, content.width(), nameHeight);
+    y += nameHeight + SPACING;
+    m_appVersion.rect = QRect(content.left(), y, content.width(), versionHeight);
+    y += versionHeight + qRound(PROGRESS_STRETCH * unit);
+    m_progressRect = QRect(content.left(), y, content.width(), BAR_HEIGHT);
+    m_statusRect = QRect(content.left(), y + BAR_HEIGHT + PROGRESS_SPACING,
+                         content.width(), STATUS_HEIGHT);
+    y += progressHeight + qRound(FOOTER_STRETCH * unit);
+    m_companyLogoSlot = QRect(content.center().x() - m_companyLogoSize.width() / 2, y,
+                              m_companyLogoSize.width(), m_companyLogoSize.height());
+    y += m_companyLogoSize.height() + COMPANY_SPACING;
+    m_companyName.rect = QRect(content.left(), y, content.width(), companyNameHeight);
+    m_status.rect = m_statusRect;
+
+    // Elision depends on the width: re-prepare every text
+    for (Text *text : {&m_appName, &m_appVersion, &m_companyName, &m_status}) {
+        prepareText(*text, text->text);
+    }
+}
+
+void SplashFlatRenderer::prepareText(Text &text, const QString &value)
+{
+    text.text = value;
+    const QFontMetrics metrics(text.font);
+    const int width = qMax(0, m_windowSize.width() - MARGIN_LEFT - MARGIN_RIGHT);
+    text.staticText.setTextFormat(Qt::PlainText);
+    text.staticText.setPerformanceHint(QStaticText::AggressiveCaching);
+    text.staticText.setText(metrics.elidedText(value, Qt::ElideRight, width));
+    text.staticText.prepare(QTransform(), text.font);
+}
+
+void SplashFlatRenderer::drawText(QPainter &painter, const Text &text) const
+{
+    const QSizeF size = text.staticText.size();
+    const QPointF origin(text.rect.x() + (text.rect.width() - size.width()) / 2.0,
+                         text.rect.y() + (text.rect.height() - size.height()) / 2.0);
+    painter.setFont(text.font);
+    painter.setPen(text.color);
+    painter.drawStaticText(origin, text.staticText);
+}
+
+void SplashFlatRenderer::paintStatic(QPainter &painter)
+{
+    if (!m_logo.isNull()) {
+        painter.drawImage(QRectF(m_logoRect), m_logo);
+    }
+    drawText(painter, m_appName);
+    drawText(painter, m_appVersion);
+    if (!m_companyLogo.isNull()) {
+        painter.drawPixmap(companyLogoRect().topLeft(), m_companyLogo);
+    }
+    drawText(painter, m_companyName);
+}
+
+void SplashFlatRenderer::paintDynamic(QPainter &painter, const QRect &dirty) const
+{
+    if (dirty.intersects(m_progressRect)) {
+        painter.save();
+        painter.setRenderHint(QPainter::Antialiasing, !m_flat);
+        painter.setPen(Qt::NoPen);
+
+        const QRectF track(m_progressRect);
+        const qreal radius = track.height() / 2.0;
+        painter.setBrush(m_trackColor);
+        painter.drawRoundedRect(track, radius, radius);
+
+        QRectF chunk;
+        if (m_complete) {
+            chunk = track;
+        } else if (m_indeterminate) {
+            chunk = chunkRect(m_chunkPosition);
+        } else {
+            const qreal fraction = qBound(0.0, static_cast<qreal>(m_value) / m_maximum, 1.0);
+            chunk = QRectF(track.x(), track.y(), track.width() * fraction, track.height());
+        }
+
+        if (chunk.width() > 0.0) {
+            if (m_flat) {
+                painter.setBrush(m_chunkColor);
+            } else {
+                QLinearGradient gradient(chunk.topLeft(), chunk.topRight());
+                gradient.setColorAt(0.0, m_chunkColor);
+                gradient.setColorAt(0.5, m_chunkHighlightColor);
+                gradient.setColorAt(1.0, m_chunkColor);
+                painter.setBrush(gradient);
+            }
+            painter.drawRoundedRect(chunk, qMin(radius, chunk.width() / 2.0), radius);
+        }
+        painter.restore();
+    }
+
+    if (dirty.intersects(m_statusRect)) {
+        drawText(painter, m_status);
+    }
+}
@@ -0,0 +1,132 @@
+#ifndef SPLASHFLATRENDERER_H
+#define SPLASHFLATRENDERER_H
+
+#include <QStaticText>
+#include <QEasingCurve>
+#include <QPainter>
+#include <QPixmap>
+#include <QImage>
+#include <QString>
+#include <QColor>
+#include <QFont>
+#include <QRect>
+#include <QSize>
+
+/**
+ * @brief Draws the whole splash content for SplashScreenWidget's Flat mode.
+ *
+ * Replaces the child widget tree (layouts, labels, progress
+ * bar) with geometry computed once per size change and text prepared
+ * once per change as QStaticText. Content is split in two layers:
+ * - static: logo, name, version and footer; baked into the widget's
+ *   background cache, so it is rasterized once
+ * - dynamic: progress track and status line; drawn over the cached
+ *   background for the damaged area only
+ *
+ * Fonts follow the bundled light theme. Colors default to it too, and
+ * applyStyleSheet() reads the text colors and the progress indicator's
+ * qproperty colors from a theme; other QSS declarations do not apply.
+ * Geometry comes from SplashLayoutMetrics, shared with the widget layout.
+ */
+class SplashFlatRenderer
+{
+public:
+    SplashFlatRenderer();
+
+    // Geometry
+    void setWindowSize(const QSize &size);
+    void setLogoSize(const QSize &size);
+    void setCompanyLogoSize(const QSize &size);
+
+    // Static content
+    void setLogo(const QImage &logo);
+    void setCompanyLogo(const QPixmap &pixmap);
+    QPixmap companyLogo() const { return m_companyLogo; }
+    void setAppName(const QString &name);
+    QString appName() const { return m_appName.text; }
+    void setAppVersion(const QString &version);
+    QString appVersion() const { return m_appVersion.text; }
+    void setCompanyName(const QString &name);
+    QString companyName() const { return m_companyName.text; }
+
+    /**
+     * @brief Take the colors of #splashAppName, #splashAppVersion,
+     * #splashCompanyName and #splashStatusLabel (color) and of
+     * #splashProgressIndicator (qproperty-*Color) from @p styleSheet.
+     * Colors the sheet does not set keep their current value.
+     */
+    void applyStyleSheet(const QString &styleSheet);
+
+    // Dynamic content; setters return whether a repaint is needed
+    bool setStatus(const QString &status);
+    bool setMaximum(int maximum);
+    bool setValue(int value);
+    void setIndeterminate(bool indeterminate);
+    void setComplete(bool complete);
+    void setFlat(bool flat);
+
+    /**
+     * @brief Move the indeterminate chunk; returns the area to repaint.
+     */
+    QRect setChunkPosition(qreal position);
+
+    /**
+     * @brief Eased back-and-forth chunk motion from elapsed time.
+     */
+    QRect advanceChunk(qint64 elapsedMs);
+
+    QRect logoRect() const { return m_logoRect; }
+    QRect companyLogoRect() const;
+    QRect progressRect() const { return m_progressRect; }
+    QRect statusRect() const { return m_statusRect; }
+
+    void paintStatic(QPainter &painter);
+    void paintDynamic(QPainter &painter, const QRect &dirty) const;
+
+private:
+    struct Text {
+        QString text;
+        QFont font;
+        QColor color;
+        QStaticText staticText;
+        QRect rect;
+    };
+
+    static QColor parseColor(const QString &value);
+    static QFont makeFont(const QStringList &families, int pixelSize, int weight, qreal spacing);
+    void updateLayout();
+    void prepareText(Text &text, const QString &value);
+    void drawText(QPainter &painter, const Text &text) const;
+    QRectF chunkRect(qreal position) const;
+
+    QImage m_logo;
+    QPixmap m_companyLogo;
+    Text m_appName;
+    Text m_appVersion;
+    Text m_companyName;
+    Text m_status;
+
+    QSize m_windowSize;
+    QSize m_logoSize;
+    QSize m_companyLogoSize;
+    QRect m_logoRect;
+    QRect m_companyLogoSlot;
+    QRect m_progressRect;
+    QRect m_statusRect;
+
+    int m_maximum;
+    int m_value;
+    bool m_indeterminate;
+    bool m_complete;
+    bool m_flat;
+    qreal m_chunkPosition;
+    QEasingCurve m_easing;
+    QColor m_trackColor;
+    QColor m_chunkColor;
+    QColor m_chunkHighlightColor;
+
+    static constexpr qreal CHUNK_FRACTION = 0.3;
+    static constexpr int CYCLE_MS = 1400;
+};
+
+#endif // SPLASHFLATRENDERER_H
@@ -0,0 +1,31 @@
+#ifndef SPLASHLAYOUTMETRICS_H
+#define SPLASHLAYOUTMETRICS_H
+
+/**
+ * @brief Splash content geometry shared by both render modes.
+ *
+ * SplashScreenWidget::setupChildWidgets() builds its layouts from these
+ * values and SplashFlatRenderer computes the same rectangles from them,
+ * so the two modes cannot drift apart.
+ */
+namespace SplashLayoutMetrics {
+
+constexpr int MARGIN_LEFT = 36;
+constexpr int MARGIN_TOP = 30;
+constexpr int MARGIN_RIGHT = 36;
+constexpr int MARGIN_BOTTOM = 28;
+constexpr int SPACING = 8;
+
+constexpr int BAR_HEIGHT = 12;
+constexpr int STATUS_HEIGHT = 24;
+constexpr int PROGRESS_SPACING = 12;
+constexpr int COMPANY_SPACING = 6;
+
+// Free space split above the logo, above the progress and above the footer
+constexpr int TOP_STRETCH = 2;
+constexpr int PROGRESS_STRETCH = 3;
+constexpr int FOOTER_STRETCH = 1;
+
+} // namespace SplashLayoutMetrics
+
+#endif // SPLASHLAYOUTMETRICS_H
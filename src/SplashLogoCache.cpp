@@ -0,0 +1,141 @@
+#include "SplashLogoCache.h"
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QPainter>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QSvgRenderer>
+#include <QDebug>
+
+namespace {
+constexpr quint32 ENTRY_MAGIC = 0x53504c43;  // "SPLC"
+}
+
+SplashLogoCache::SplashLogoCache(const QString &directory)
+    : m_directory(directory)
+{
+}
+
+void SplashLogoCache::setDirectory(const QString &path)
+{
+    m_directory = path;
+}
+
+QString SplashLogoCache::defaultDirectory()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/splash_logos";
+}
+
+QImage SplashLogoCache::rasterize(const QString &svgPath, const QSize &size, qreal devicePixelRatio)
+{
+    QSvgRenderer renderer(svgPath);
+    if (!renderer.isValid() || size.isEmpty()) {
+        return QImage();
+    }
+
+    QImage image(size * devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(devicePixelRatio);
+    image.fill(Qt::transparent);
+    QPainter painter(&image);
+    renderer.render(&painter, QRectF(QPointF(0, 0), QSizeF(size)));
+    painter.end();
+    return image;
+}
+
+QImage SplashLogoCache::image(const QString &svgPath, const QSize &size, qreal devicePixelRatio) const
+{
+    const QFileInfo source(svgPath);
+    if (!source.exists() || size.isEmpty()) {
+        return QImage();
+    }
+
+    const QString entry = m_directory.isEmpty() ? QString()
+                                                : entryPath(source, size, devicePixelRatio);
+    if (!entry.isEmpty()) {
+        QImage cached = readEntry(entry, source, size * devicePixelRatio);
+        if (!cached.isNull()) {
+            cached.setDevicePixelRatio(devicePixelRatio);
+            return cached;
+        }
+    }
+
+    const QImage rendered = rasterize(svgPath, size, devicePixelRatio);
+    if (!rendered.isNull() && !entry.isEmpty()) {
+        QDir().mkpath(m_directory);
+        if (!writeEntry(entry, source, rendered)) {
+            qWarning() << "SplashScreen: Could not write logo cache entry:" << entry;
+        }
+    }
+    return rendered;
+}
+
+QString SplashLogoCache::entryPath(const QFileInfo &source, const QSize &size,
+                                   qreal devicePixelRatio) const
+{
+    // Source freshness is checked against the entry header, not the name,
+    // so an edited file overwrites its old entry instead of adding one.
+    const QByteArray key = QString("%1|%2x%3|%4").arg(source.absoluteFilePath())
+                               .arg(size.width()).arg(size.height())
+                               .arg(devicePixelRatio).toUtf8();
+    const QByteArray hash = QCryptographicHash::hash(key, QCryptographicHash::Sha1).toHex();
+    return m_directory + "/" + QString::fromLatin1(hash) + ".raster";
+}
+
+QImage SplashLogoCache::readEntry(const QString &path, const QFileInfo &source,
+                                  const QSize &pixelSize)
+{
+    QFile file(path);
+    if (!file.open(QFile::ReadOnly)) {
+        return QImage();
+    }
+
+    QDataStream in(&file);
+    quint32 magic = 0;
+    quint32 version = 0;
+    qint64 sourceModified = 0;
+    qint64 sourceSize = 0;
+    qint32 width = 0;
+    qint32 height = 0;
+    qint32 bytesPerLine = 0;
+    in >> magic >> version >> sourceModified >> sourceSize >> width >> height >> bytesPerLine;
+
+    if (in.status() != QDataStream::Ok || magic != ENTRY_MAGIC || version != FORMAT_VERSION
+        || sourceModified != source.lastModified().toMSecsSinceEpoch()
+        || sourceSize != source.size()
+        || width != pixelSize.width() || height != pixelSize.height()) {
+        return QImage();
+    }
+
+    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
+    if (image.isNull() || image.bytesPerLine() != bytesPerLine) {
+        return QImage();
+    }
+    const qsizetype bytes = image.sizeInBytes();
+    if (in.readRawData(reinterpret_cast<char *>(image.bits()), static_cast<int>(bytes)) != bytes) {
+        return QImage();
+    }
+    return image;
+}
+
+bool SplashLogoCache::writeEntry(const QString &path, const QFileInfo &source, const QImage &image)
+{
+    QSaveFile file(path);
+    if (!file.open(QFile::WriteOnly)) {
+        return false;
+    }
+
+    QDataStream out(&file);
+    out << ENTRY_MAGIC << FORMAT_VERSION
+        << static_cast<qint64>(source.lastModified().toMSecsSinceEpoch())
+        << static_cast<qint64>(source.size())
+        << static_cast<qint32>(image.width()) << static_cast<qint32>(image.height())
+        << static_cast<qint32>(image.bytesPerLine());
+    out.writeRawData(reinterpret_cast<const char *>(image.constBits()),
+                     static_cast<int>(image.sizeInBytes()));
+
+    return out.status() == QDataStream::Ok && file.commit();
+}
@@ -0,0 +1,60 @@
+#ifndef SPLASHLOGOCACHE_H
+#define SPLASHLOGOCACHE_H
+
+#include <QString>
+#include <QImage>
+#include <QSize>
+
+class QFileInfo;
+
+/**
+ * @brief Persistent raster cache for SVG logos.
+ *
+ * Each (file path, logical size, device pixel ratio) gets one entry on
+ * disk holding the rendered logo as raw premultiplied ARGB32 plus the
+ * source's modification time and size. A warm start reads the pixels back
+ * with a single file read: no SVG parsing, no rendering, no image decoding.
+ * An edited source (different mtime or size) is re-rendered and the entry
+ * overwritten, so the directory never holds more than one entry per key.
+ *
+ * All methods are reentrant and may run on a worker thread.
+ */
+class SplashLogoCache
+{
+public:
+    static constexpr quint32 FORMAT_VERSION = 1;
+
+    explicit SplashLogoCache(const QString &directory = QString());
+
+    /**
+     * @brief Cache directory; an empty path disables the disk cache.
+     */
+    void setDirectory(const QString &path);
+    QString directory() const { return m_directory; }
+
+    /**
+     * @brief Raster of @p svgPath at @p size logical pixels.
+     * @return Premultiplied image with its device pixel ratio set, or a
+     * null image if the file is missing or not a valid SVG
+     */
+    QImage image(const QString &svgPath, const QSize &size, qreal devicePixelRatio) const;
+
+    /**
+     * @brief Render an SVG without touching the cache.
+     */
+    static QImage rasterize(const QString &svgPath, const QSize &size, qreal devicePixelRatio);
+
+    /**
+     * @brief Default location under the application cache directory.
+     */
+    static QString defaultDirectory();
+
+private:
+    QString entryPath(const QFileInfo &source, const QSize &size, qreal devicePixelRatio) const;
+    static QImage readEntry(const QString &path, const QFileInfo &source, const QSize &pixelSize);
+    static bool writeEntry(const QString &path, const QFileInfo &source, const QImage &image);
+
+    QString m_directory;
+};
+
+#endif // SPLASHLOGOCACHE_H
@@ -0,0 +1,69 @@
+#include "SplashProgressChannel.h"
+#include <QThread>
+
+SplashProgressChannel::SplashProgressChannel()
+    : m_progress(0)
+    , m_statusSequence(0)
+    , m_statusLength(0)
+    , m_takenSequence(0)
+{
+}
+
+void SplashProgressChannel::postProgress(int step, qreal fraction)
+{
+    const int subStep = qBound(0, qRound(fraction * FRACTION_RESOLUTION), FRACTION_RESOLUTION - 1);
+    m_progress.store(qMax(0, step) * FRACTION_RESOLUTION + subStep, std::memory_order_relaxed);
+}
+
+void SplashProgressChannel::postStatus(const QString &message)
+{
+    int length = qMin(static_cast<int>(message.size()), STATUS_CAPACITY);
+    if (length < message.size() && message.at(length - 1).isHighSurrogate()) {
+        --length;  // Do not cut a surrogate pair in half
+    }
+
+    // Make the sequence odd; another writer holding it is done after one copy
+    quint32 sequence = m_statusSequence.load(std::memory_order_relaxed);
+    do {
+        while (sequence & 1) {
+            QThread::yieldCurrentThread();
+            sequence = m_statusSequence.load(std::memory_order_relaxed);
+        }
+    } while (!m_statusSequence.compare_exchange_weak(sequence, sequence + 1,
+                                                     std::memory_order_relaxed));
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const QChar *text = message.constData();
+    for (int i = 0; i < length; ++i) {
+        m_statusText[i].store(text[i].unicode(), std::memory_order_relaxed);
+    }
+    m_statusLength.store(length, std::memory_order_relaxed);
+    m_statusSequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool SplashProgressChannel::takeStatus(QString *message)
+{
+    char16_t text[STATUS_CAPACITY];
+    quint32 before = 0;
+    int length = 0;
+    do {
+        before = m_statusSequence.load(std::memory_order_acquire);
+        if (before == m_takenSequence) {
+            return false;
+        }
+        if (before & 1) {
+            QThread::yieldCurrentThread();
+            continue;
+        }
+        length = m_statusLength.load(std::memory_order_relaxed);
+        for (int i = 0; i < length; ++i) {
+            text[i] = m_statusText[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((before & 1) || m_statusSequence.load(std::memory_order_relaxed) != before);
+
+    // Torn copies were retried above: this one is a whole message
+    m_takenSequence = before;
+    *message = QString(reinterpret_cast<const QChar *>(text), length);
+    return true;
+}
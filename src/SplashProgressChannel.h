@@ -0,0 +1,62 @@
+#ifndef SPLASHPROGRESSCHANNEL_H
+#define SPLASHPROGRESSCHANNEL_H
+
+#include <QString>
+#include <atomic>
+
+/**
+ * @brief Lock-free channel from any thread to the splash screen.
+ *
+ * Progress is a single atomic integer; the status text lives in a fixed
+ * seqlock slot holding the latest message (older unread messages are
+ * dropped). Posting copies into that slot: no allocation, no events, no
+ * locks on the GUI side. Concurrent writers only wait for each other for
+ * the length of one copy. The splash drains the channel once per frame,
+ * so GUI-thread cost is constant no matter how often workers report.
+ *
+ * Obtain it with SplashScreenWidget::progressChannel(). The channel is
+ * shared-owned, so workers may keep writing after the splash is gone.
+ */
+class SplashProgressChannel
+{
+public:
+    static constexpr int FRACTION_RESOLUTION = 100;
+    static constexpr int STATUS_CAPACITY = 256;  ///< UTF-16 units; longer messages are truncated
+
+    SplashProgressChannel();
+
+    SplashProgressChannel(const SplashProgressChannel &) = delete;
+    SplashProgressChannel &operator=(const SplashProgressChannel &) = delete;
+
+    /**
+     * @brief Publish the number of completed steps plus the fraction of the
+     * current one (0.0 - 1.0). Thread-safe, wait-free.
+     */
+    void postProgress(int step, qreal fraction);
+
+    /**
+     * @brief Publish a status line, replacing any unread one. Thread-safe,
+     * allocation-free; at most STATUS_CAPACITY UTF-16 units are kept.
+     */
+    void postStatus(const QString &message);
+
+    /**
+     * @brief Latest progress as step * FRACTION_RESOLUTION + fraction.
+     */
+    int progressValue() const { return m_progress.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Take the unread status message, if any. Consumer side only.
+     * @return true if a message was waiting
+     */
+    bool takeStatus(QString *message);
+
+private:
+    std::atomic<int> m_progress;
+    std::atomic<quint32> m_statusSequence;  ///< Odd while a writer is copying
+    std::atomic<int> m_statusLength;
+    std::atomic<char16_t> m_statusText[STATUS_CAPACITY];
+    quint32 m_takenSequence;  ///< Consumer side only
+};
+
+#endif // SPLASHPROGRESSCHANNEL_H
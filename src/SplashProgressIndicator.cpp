@@ -0,0 +1,155 @@
+#include "SplashProgressIndicator.h"
+#include <QPainter>
+#include <QPainterPath>
+#include <QPaintEvent>
+#include <QScreen>
+#include <QLinearGradient>
+#include <QtMath>
+
+SplashProgressIndicator::SplashProgressIndicator(QWidget *parent)
+    : QWidget(parent)
+    , m_timer(new QTimer(this))
+    , m_easing(QEasingCurve::InOutSine)
+    , m_position(0.0)
+    , m_complete(false)
+    , m_flat(false)
+    , m_requestedInterval(0)
+    , m_cycleDuration(DEFAULT_CYCLE_MS)
+    , m_trackColor(17, 169, 157, 31)
+    , m_chunkColor(0x11, 0xa9, 0x9d)
+    , m_chunkHighlightColor(0x33, 0xd4, 0xc8)
+{
+    setAttribute(Qt::WA_TranslucentBackground, true);
+    m_timer->setTimerType(Qt::PreciseTimer);
+    connect(m_timer, &QTimer::timeout, this, &SplashProgressIndicator::onFrame);
+}
+
+void SplashProgressIndicator::start()
+{
+    m_complete = false;
+    m_clock.start();
+    m_timer->start(frameInterval());
+    update();
+}
+
+void SplashProgressIndicator::stop()
+{
+    m_timer->stop();
+}
+
+void SplashProgressIndicator::setPosition(qreal position)
+{
+    stop();
+    m_complete = false;
+    moveChunkTo(qBound<qreal>(0.0, position, 1.0));
+}
+
+void SplashProgressIndicator::setComplete(bool complete)
+{
+    stop();
+    m_complete = complete;
+    update();
+}
+
+void SplashProgressIndicator::setFrameInterval(int milliseconds)
+{
+    m_requestedInterval = qMax(0, milliseconds);
+    if (m_timer->isActive()) {
+        // The clock keeps running, so the chunk does not jump
+        m_timer->start(frameInterval());
+    }
+}
+
+int SplashProgressIndicator::frameInterval() const
+{
+    return (m_requestedInterval > 0) ? m_requestedInterval : displayRefreshInterval();
+}
+
+void SplashProgressIndicator::setCycleDuration(int milliseconds)
+{
+    m_cycleDuration = qMax(100, milliseconds);
+}
+
+int SplashProgressIndicator::displayRefreshInterval() const
+{
+    const QScreen *display = screen();
+    const qreal rate = display ? display->refreshRate() : 60.0;
+    return qMax(1, qFloor(1000.0 / qMax<qreal>(rate, 1.0)));
+}
+
+void SplashProgressIndicator::setFlat(bool flat)
+{
+    if (m_flat != flat) {
+        m_flat = flat;
+        update();
+    }
+}
+
+void SplashProgressIndicator::setTrackColor(const QColor &color)
+{
+    m_trackColor = color;
+    update();
+}
+
+void SplashProgressIndicator::setChunkColor(const QColor &color)
+{
+    m_chunkColor = color;
+    update();
+}
+
+void SplashProgressIndicator::setChunkHighlightColor(const QColor &color)
+{
+    m_chunkHighlightColor = color;
+    update();
+}
+
+QRectF SplashProgressIndicator::chunkRect(qreal position) const
+{
+    const qreal chunkWidth = width() * CHUNK_FRACTION;
+    const qreal travel = width() - chunkWidth;
+    return QRectF(travel * position, 0.0, chunkWidth, height());
+}
+
+void SplashProgressIndicator::moveChunkTo(qreal position)
+{
+    const QRectF before = chunkRect(m_position);
+    m_position = position;
+    const QRectF after = chunkRect(m_position);
+
+    // Damage only what the chunk covered and now covers (+1 px for AA)
+    const QRect dirty = before.united(after).toAlignedRect().adjusted(-1, 0, 1, 0);
+    update(dirty.intersected(rect()));
+}
+
+void SplashProgressIndicator::onFrame()
+{
+    // Time-based ping-pong: t runs 0 -> 1 -> 0 once per two cycles
+    const qint64 period = 2 * static_cast<qint64>(m_cycleDuration);
+    const qreal phase = static_cast<qreal>(m_clock.elapsed() % period) / m_cycleDuration;
+    const qreal t = (phase <= 1.0) ? phase : 2.0 - phase;
+    moveChunkTo(m_easing.valueForProgress(t));
+}
+
+void SplashProgressIndicator::paintEvent(QPaintEvent * /* event */)
+{
+    // The painter is clipped to the damaged region by the backing store
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing, !m_flat);
+    painter.setPen(Qt::NoPen);
+
+    const qreal radius = height() / 2.0;
+    painter.setBrush(m_trackColor);
+    painter.drawRoundedRect(QRectF(rect()), radius, radius);
+
+    const QRectF chunk = m_complete ? QRectF(rect()) : chunkRect(m_position);
+    if (m_flat) {
+        painter.setBrush(m_chunkColor);
+    } else {
+        QLinearGradient gradient(chunk.topLeft(), chunk.topRight());
+        gradient.setColorAt(0.0, m_chunkColor);
+        gradient.setColorAt(0.5, m_chunkHighlightColor);
+        gradient.setColorAt(1.0, m_chunkColor);
+        painter.setBrush(gradient);
+    }
+    painter.drawRoundedRect(chunk, radius, radius);
+}
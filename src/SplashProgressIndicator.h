@@ -0,0 +1,104 @@
+#ifndef SPLASHPROGRESSINDICATOR_H
+#define SPLASHPROGRESSINDICATOR_H
+
+#include <QWidget>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QEasingCurve>
+#include <QColor>
+#include <QRectF>
+
+/**
+ * @brief Custom-drawn indeterminate progress indicator.
+ *
+ * A chunk slides back and forth across a rounded track. Its position is
+ * computed from elapsed time with an easing curve, so motion is sub-pixel
+ * smooth whatever the tick jitter. Ticks come from the widget's own timer,
+ * at the refresh rate of its screen by default, and each tick invalidates
+ * only the union of the old and new chunk rectangles: the rest of the
+ * window is never repainted by the animation.
+ *
+ * Colors are exposed as properties so themes can set them from QSS:
+ * @code
+ * #splashProgressIndicator {
+ *     qproperty-trackColor: rgba(17, 169, 157, 0.12);
+ *     qproperty-chunkColor: #11a99d;
+ *     qproperty-chunkHighlightColor: #33d4c8;
+ * }
+ * @endcode
+ */
+class SplashProgressIndicator : public QWidget
+{
+    Q_OBJECT
+    Q_PROPERTY(QColor trackColor READ trackColor WRITE setTrackColor)
+    Q_PROPERTY(QColor chunkColor READ chunkColor WRITE setChunkColor)
+    Q_PROPERTY(QColor chunkHighlightColor READ chunkHighlightColor WRITE setChunkHighlightColor)
+
+public:
+    explicit SplashProgressIndicator(QWidget *parent = nullptr);
+
+    void start();
+    void stop();
+    bool isRunning() const { return m_timer->isActive(); }
+
+    /**
+     * @brief Freeze the indicator at a position (0.0 - 1.0 of the travel).
+     */
+    void setPosition(qreal position);
+    qreal position() const { return m_position; }
+
+    /**
+     * @brief Stop the animation and fill the whole track.
+     */
+    void setComplete(bool complete);
+
+    /**
+     * @brief Tick interval in milliseconds; 0 (default) follows the display
+     * refresh rate.
+     */
+    void setFrameInterval(int milliseconds);
+    int frameInterval() const;
+
+    void setCycleDuration(int milliseconds);
+
+    /**
+     * @brief Draw the chunk in a solid color (no gradient, no antialiasing).
+     */
+    void setFlat(bool flat);
+    bool isFlat() const { return m_flat; }
+
+    QColor trackColor() const { return m_trackColor; }
+    void setTrackColor(const QColor &color);
+    QColor chunkColor() const { return m_chunkColor; }
+    void setChunkColor(const QColor &color);
+    QColor chunkHighlightColor() const { return m_chunkHighlightColor; }
+    void setChunkHighlightColor(const QColor &color);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
+private slots:
+    void onFrame();
+
+private:
+    QRectF chunkRect(qreal position) const;
+    void moveChunkTo(qreal position);
+    int displayRefreshInterval() const;
+
+    QTimer *m_timer;
+    QElapsedTimer m_clock;
+    QEasingCurve m_easing;
+    qreal m_position;
+    bool m_complete;
+    bool m_flat;
+    int m_requestedInterval;
+    int m_cycleDuration;
+    QColor m_trackColor;
+    QColor m_chunkColor;
+    QColor m_chunkHighlightColor;
+
+    static constexpr qreal CHUNK_FRACTION = 0.3;
+    static constexpr int DEFAULT_CYCLE_MS = 1400;
+};
+
+#endif // SPLASHPROGRESSINDICATOR_H
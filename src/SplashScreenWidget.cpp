@@ -1,13 +1,29 @@
 #include "SplashScreenWidget.h"
+#include "SplashDisplayProbe.h"
+#include "SplashLayoutMetrics.h"
 #include <QScreen>
 #include <QGuiApplication>
 #include <QDebug>
-#include <QGraphicsDropShadowEffect>
 #include <QRegion>
 #include <QPixmap>
-#include <QSvgRenderer>
+#include <QtMath>
+#include <QPaintEvent>
+#include <QResizeEvent>
+#include <QWindow>
+#include <QFutureWatcher>
+#include <QtConcurrent>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QCryptographicHash>
+#include <QFileInfo>
+#include <QDateTime>
 
 SplashScreenWidget::SplashScreenWidget(QWidget *parent)
+    : SplashScreenWidget(RenderMode::Widgets, parent)
+{
+}
+
+SplashScreenWidget::SplashScreenWidget(RenderMode mode, QWidget *parent)
     : QWidget(parent)
     , m_mainLayout(nullptr)
     , m_logoWidget(nullptr)
@@ -16,13 +32,40 @@ SplashScreenWidget::SplashScreenWidget(QWidget *parent)
     , m_companyNameLabel(nullptr)
     , m_companyLogoLabel(nullptr)
     , m_progressBar(nullptr)
+    , m_progressIndicator(nullptr)
     , m_statusLabel(nullptr)
     , m_progressContainer(nullptr)
     , m_companyContainer(nullptr)
-    , m_bounceTimer(nullptr)
+    , m_renderMode(mode)
+    , m_flatAnimating(false)
     , m_progressPosition(0)
-    , m_bounceDirection(1)
+    , m_repaintedPixels(0)
+    , m_repaintedPixelsPerSecond(0)
+    , m_windowMode(WindowMode::Auto)
+    , m_opaqueMasked(false)
+    , m_maskRadius(-1)
+    , m_performanceTier(SplashDisplayProbe::isConstrained() ? RenderTier::Reduced : RenderTier::Full)
+    , m_renderTier(RenderTier::Full)
+    , m_adaptiveRendering(true)
+    , m_exposed(true)
+    , m_windowHooked(false)
+    , m_flatChrome(false)
+    , m_frameBudgetMs(DEFAULT_FRAME_BUDGET_MS)
+    , m_frameCostMs(0.0)
+    , m_slowFrameStreak(0)
+    , m_upgradeDelayMs(TIER_UPGRADE_DELAY_MS)
+    , m_frameTimer(nullptr)
+    , m_timingHistoryLoaded(false)
+    , m_weightedFraction(0.0)
+    , m_remainingMs(0)
+    , m_showRemainingTime(false)
+    , m_channel(std::make_shared<SplashProgressChannel>())
+    , m_appliedSubStepValue(0)
+    , m_updateMode(UpdateMode::Immediate)
+    , m_statusDirty(false)
     , m_minimumDisplayDuration(2000)
+    , m_showDelay(0)
+    , m_closingDelay(DEFAULT_CLOSING_DELAY_MS)
     , m_totalSteps(100)
     , m_currentStep(0)
     , m_progressMode(ProgressMode::Indeterminate)
@@ -34,20 +77,48 @@ SplashScreenWidget::SplashScreenWidget(QWidget *parent)
     , m_borderWidth(1)
     , m_borderColor(0, 0, 0, 20)
     , m_backgroundColor(255, 255, 255)
+    , m_logoCache(SplashLogoCache::defaultDirectory())
+    , m_logoFromBundle(false)
+    , m_styleSheetCache(SplashStyleSheetCache::defaultDirectory())
+    , m_pruneStyleSheets(true)
+    , m_styleSheetPath()
+    , m_pendingAssets(0)
+    , m_logoGeneration(0)
+    , m_companyLogoGeneration(0)
+    , m_styleGeneration(0)
+    , m_logoPending(false)
+    , m_companyLogoPending(false)
+    , m_snapshotPath(SplashSnapshotWindow::defaultPath())
+    , m_waitingForAssets(false)
+    , m_waitingForShowDelay(false)
+    , m_updateDepth(0)
+    , m_geometryDirty(false)
+    , m_logoDirty(false)
+    , m_companyLogoDirty(false)
+    , m_deferredStyleSheetAsync(false)
+    , m_deferredStyleSheet()
     , m_minimumDurationElapsed(false)
     , m_finishRequested(false)
+    , m_finishRequestedMs(-1)
     , m_isClosed(false)
+    , m_shown(false)
+    , m_releaseOnFinish(false)
+    , m_released(false)
 {
     qDebug() << "SplashScreenWidget ctor"
              << "class:" << metaObject()->className()
              << "splashFinished index:" << metaObject()->indexOfSignal("splashFinished()");
     setupUi();
+    applyRenderTier();
 }
 
 SplashScreenWidget::~SplashScreenWidget()
 {
-    if (m_bounceTimer) {
-        m_bounceTimer->stop();
+    if (m_progressIndicator) {
+        m_progressIndicator->stop();
+    }
+    if (m_frameTimer) {
+        m_frameTimer->stop();
     }
 }
 
@@ -55,13 +126,36 @@ void SplashScreenWidget::setupUi()
 {
     // Window flags for splash screen behavior with transparency
     setWindowFlags(Qt::FramelessWindowHint | Qt::WindowStaysOnTopHint | Qt::SplashScreen);
-    setAttribute(Qt::WA_TranslucentBackground, true);
+    applyWindowMode();
     setFixedSize(m_windowSize);
+    m_statusMessage = "Initializing...";
+
+    if (m_renderMode == RenderMode::Flat) {
+        // No child widgets: paintEvent() draws everything
+        m_flatRenderer = std::make_unique<SplashFlatRenderer>();
+        m_flatRenderer->setWindowSize(m_windowSize);
+        m_flatRenderer->setLogoSize(m_logoSize);
+        m_flatRenderer->setCompanyLogoSize(m_companyLogoSize);
+        m_flatRenderer->setStatus(m_statusMessage);
+    } else {
+        setupChildWidgets();
+    }
+
+    // Frame timer for time-driven (duration-weighted) progress
+    m_frameTimer = new QTimer(this);
+    m_frameTimer->setTimerType(Qt::PreciseTimer);
+    connect(m_frameTimer, &QTimer::timeout, this, &SplashScreenWidget::onFrameTick);
+
+    setObjectName("splashScreen");
+}
 
+void SplashScreenWidget::setupChildWidgets()
+{
     // Main layout with adequate margins
     m_mainLayout = new QVBoxLayout(this);
-    m_mainLayout->setContentsMargins(36, 30, 36, 28);
-    m_mainLayout->setSpacing(8);
+    m_mainLayout->setContentsMargins(SplashLayoutMetrics::MARGIN_LEFT, SplashLayoutMetrics::MARGIN_TOP,
+                                     SplashLayoutMetrics::MARGIN_RIGHT, SplashLayoutMetrics::MARGIN_BOTTOM);
+    m_mainLayout->setSpacing(SplashLayoutMetrics::SPACING);
 
     // Logo container (centered)
     QWidget *logoContainer = new QWidget(this);
@@ -69,19 +163,15 @@ void SplashScreenWidget::setupUi()
     QHBoxLayout *logoLayout = new QHBoxLayout(logoContainer);
     logoLayout->setContentsMargins(0, 0, 0, 0);
 
-    m_logoWidget = new QSvgWidget(this);
+    m_logoWidget = new QLabel(this);
     m_logoWidget->setFixedSize(m_logoSize);
+    m_logoWidget->setAlignment(Qt::AlignCenter);
     m_logoWidget->setObjectName("splashLogo");
-    auto *logoShadow = new QGraphicsDropShadowEffect(this);
-    logoShadow->setBlurRadius(18);
-    logoShadow->setOffset(0, 6);
-    logoShadow->setColor(QColor(0, 0, 0, 55));
-    m_logoWidget->setGraphicsEffect(logoShadow);
     logoLayout->addStretch();
     logoLayout->addWidget(m_logoWidget);
     logoLayout->addStretch();
 
-    m_mainLayout->addStretch(2);
+    m_mainLayout->addStretch(SplashLayoutMetrics::TOP_STRETCH);
     m_mainLayout->addWidget(logoContainer);
 
     // App name label
@@ -98,14 +188,14 @@ void SplashScreenWidget::setupUi()
     m_appVersionLabel->setText("v1.0.0");
     m_mainLayout->addWidget(m_appVersionLabel);
 
-    m_mainLayout->addStretch(3);
+    m_mainLayout->addStretch(SplashLayoutMetrics::PROGRESS_STRETCH);
 
     // Progress section container with fixed layout
     m_progressContainer = new QWidget(this);
     m_progressContainer->setObjectName("progressContainer");
     QVBoxLayout *progressLayout = new QVBoxLayout(m_progressContainer);
     progressLayout->setContentsMargins(0, 0, 0, 0);
-    progressLayout->setSpacing(12);
+    progressLayout->setSpacing(SplashLayoutMetrics::PROGRESS_SPACING);
 
     // Modern progress bar
     m_progressBar = new QProgressBar(this);
@@ -114,39 +204,41 @@ void SplashScreenWidget::setupUi()
     m_progressBar->setMinimum(0);
     m_progressBar->setMaximum(100);
     m_progressBar->setValue(0);
-    m_progressBar->setFixedHeight(12);
+    m_progressBar->setFixedHeight(SplashLayoutMetrics::BAR_HEIGHT);
+    m_progressBar->setVisible(false);
     progressLayout->addWidget(m_progressBar);
 
+    // Custom-drawn indicator for indeterminate mode (shares the bar's slot)
+    m_progressIndicator = new SplashProgressIndicator(this);
+    m_progressIndicator->setObjectName("splashProgressIndicator");
+    m_progressIndicator->setFixedHeight(SplashLayoutMetrics::BAR_HEIGHT);
+    progressLayout->addWidget(m_progressIndicator);
+
     // Status label with fixed height to prevent overlap
     m_statusLabel = new QLabel(this);
     m_statusLabel->setObjectName("splashStatusLabel");
     m_statusLabel->setAlignment(Qt::AlignCenter);
-    m_statusLabel->setText("Initializing...");
-    m_statusLabel->setFixedHeight(24);
+    m_statusLabel->setText(m_statusMessage);
+    m_statusLabel->setFixedHeight(SplashLayoutMetrics::STATUS_HEIGHT);
     m_statusLabel->setWordWrap(false);
     progressLayout->addWidget(m_statusLabel);
 
     m_mainLayout->addWidget(m_progressContainer);
 
-    m_mainLayout->addStretch(1);
+    m_mainLayout->addStretch(SplashLayoutMetrics::FOOTER_STRETCH);
 
     // Company footer (logo + name)
     m_companyContainer = new QWidget(this);
     m_companyContainer->setObjectName("companyContainer");
     QVBoxLayout *companyLayout = new QVBoxLayout(m_companyContainer);
     companyLayout->setContentsMargins(0, 0, 0, 0);
-    companyLayout->setSpacing(6);
+    companyLayout->setSpacing(SplashLayoutMetrics::COMPANY_SPACING);
 
     m_companyLogoLabel = new QLabel(this);
     m_companyLogoLabel->setObjectName("splashCompanyLogo");
     m_companyLogoLabel->setFixedSize(m_companyLogoSize);
     m_companyLogoLabel->setAlignment(Qt::AlignCenter);
     m_companyLogoLabel->setScaledContents(false);
-    auto *companyShadow = new QGraphicsDropShadowEffect(this);
-    companyShadow->setBlurRadius(12);
-    companyShadow->setOffset(0, 4);
-    companyShadow->setColor(QColor(0, 0, 0, 45));
-    m_companyLogoLabel->setGraphicsEffect(companyShadow);
 
     m_companyNameLabel = new QLabel(this);
     m_companyNameLabel->setObjectName("splashCompanyName");
@@ -157,28 +249,98 @@ void SplashScreenWidget::setupUi()
     companyLayout->addWidget(m_companyNameLabel);
 
     m_mainLayout->addWidget(m_companyContainer);
+}
 
-    // Bounce timer for indeterminate progress
-    m_bounceTimer = new QTimer(this);
-    connect(m_bounceTimer, &QTimer::timeout, this, &SplashScreenWidget::updateBouncingProgress);
+void SplashScreenWidget::paintEvent(QPaintEvent *event)
+{
+    const qreal dpr = devicePixelRatioF();
+    const QSize pixelSize = size() * dpr;
+    if (m_backgroundCache.isNull()
+        || m_backgroundCache.size() != pixelSize
+        || !qFuzzyCompare(m_backgroundCache.devicePixelRatio(), dpr)
+        || m_logoShadow.anchor != logoAnchor()
+        || m_companyLogoShadow.anchor != companyLogoAnchor()) {
+        rebuildBackgroundCache(dpr);
+    }
 
-    setObjectName("splashScreen");
+    accountRepaint(event->region());
+
+    // Hot path: a single blit of the damaged area
+    const QRect target = event->rect();
+    const QRectF source(target.x() * dpr, target.y() * dpr,
+                        target.width() * dpr, target.height() * dpr);
+    QPainter painter(this);
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+    painter.drawPixmap(QRectF(target), m_backgroundCache, source);
+
+    // Flat mode: progress and status over the cached static content
+    if (m_flatRenderer) {
+        painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+        m_flatRenderer->paintDynamic(painter, target);
+    }
 }
 
-void SplashScreenWidget::paintEvent(QPaintEvent * /* event */)
+void SplashScreenWidget::accountRepaint(const QRegion &region)
 {
-    QPainter painter(this);
+    // Child repaints on a translucent window also repaint the parent
+    // region underneath, so this sees every damaged pixel.
+    const qreal dpr = devicePixelRatioF();
+    qint64 pixels = 0;
+    for (const QRect &r : region) {
+        pixels += static_cast<qint64>(r.width()) * r.height();
+    }
+    m_repaintedPixels += qRound64(pixels * dpr * dpr);
+
+    if (!m_repaintWindow.isValid()) {
+        m_repaintWindow.start();
+    } else if (m_repaintWindow.elapsed() >= 1000) {
+        m_repaintedPixelsPerSecond = m_repaintedPixels * 1000 / m_repaintWindow.restart();
+        m_repaintedPixels = 0;
+    }
+}
+
+void SplashScreenWidget::invalidateBackgroundCache()
+{
+    m_backgroundCache = QPixmap();
+    update();
+}
+
+void SplashScreenWidget::rebuildBackgroundCache(qreal devicePixelRatio)
+{
+    m_backgroundCache = QPixmap(size() * devicePixelRatio);
+    m_backgroundCache.setDevicePixelRatio(devicePixelRatio);
+    // Opaque mode: no alpha channel; pixels outside the mask are never shown
+    m_backgroundCache.fill(m_opaqueMasked ? m_backgroundColor : QColor(Qt::transparent));
+
+    QPainter painter(&m_backgroundCache);
     painter.setRenderHint(QPainter::Antialiasing, true);
 
     // Create rounded rectangle path
     QPainterPath path;
     path.addRoundedRect(rect(), m_borderRadius, m_borderRadius);
 
-    // Draw shadow first (offset)
-    painter.save();
-    painter.translate(0, 4);
-    painter.fillPath(path, QColor(0, 0, 0, 40));
-    painter.restore();
+    // Minimal tier: solid fill and border only
+    if (m_flatChrome) {
+        painter.fillPath(path, m_backgroundColor);
+        if (m_borderWidth > 0) {
+            const qreal half = m_borderWidth / 2.0;
+            painter.setPen(QPen(m_borderColor, m_borderWidth));
+            painter.drawRoundedRect(QRectF(rect()).adjusted(half, half, -half, -half),
+                                    m_borderRadius, m_borderRadius);
+        }
+        if (m_flatRenderer) {
+            m_flatRenderer->paintStatic(painter);
+        }
+        return;
+    }
+
+    // Draw shadow first (offset); clipped away by the mask in opaque mode
+    if (!m_opaqueMasked) {
+        painter.save();
+        painter.translate(0, 4);
+        painter.fillPath(path, QColor(0, 0, 0, 40));
+        painter.restore();
+    }
 
     // Draw background with gradient
     QLinearGradient gradient(0, 0, 0, height());
@@ -204,314 +366,1752 @@ void SplashScreenWidget::paintEvent(QPaintEvent * /* event */)
         painter.setPen(QPen(m_borderColor, m_borderWidth));
         painter.drawPath(borderPath);
     }
-}
 
-void SplashScreenWidget::applyRoundedMask()
-{
-    QPainterPath path;
-    path.addRoundedRect(rect(), m_borderRadius, m_borderRadius);
-    QRegion region(path.toFillPolygon().toPolygon());
-    setMask(region);
-}
+    // Placeholder while the logo loads in the background
+    if (m_logoPending) {
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(QColor(0, 0, 0, 12));
+        painter.drawRoundedRect(QRectF(logoAnchor(), QSizeF(m_logoSize)), 16, 16);
+    }
 
-void SplashScreenWidget::setLogoPath(const QString &svgPath)
-{
-    if (QFile::exists(svgPath)) {
-        m_logoWidget->load(svgPath);
-    } else {
-        qWarning() << "SplashScreen: Logo file not found:" << svgPath;
+    // Logo shadows sit underneath the logo widgets
+    updateBakedShadows(devicePixelRatio);
+    for (const BakedShadow *baked : {&m_logoShadow, &m_companyLogoShadow}) {
+        if (baked->shadow.image.isNull()) {
+            continue;
+        }
+        const qreal margin = baked->shadow.padding / baked->shadow.image.devicePixelRatio();
+        const int offsetY = (baked == &m_logoShadow) ? LOGO_SHADOW_OFFSET_Y : COMPANY_SHADOW_OFFSET_Y;
+        painter.drawImage(QPointF(baked->anchor) + QPointF(-margin, offsetY - margin),
+                          baked->shadow.image);
     }
-}
 
-void SplashScreenWidget::setLogoSize(const QSize &size)
-{
-    m_logoSize = size;
-    m_logoWidget->setFixedSize(size);
+    // Flat mode: static content is part of the background
+    if (m_flatRenderer) {
+        m_flatRenderer->paintStatic(painter);
+    }
 }
 
-void SplashScreenWidget::setMinimumDisplayDuration(int milliseconds)
+QPoint SplashScreenWidget::logoAnchor() const
 {
-    m_minimumDisplayDuration = milliseconds;
+    if (m_flatRenderer) {
+        return m_flatRenderer->logoRect().topLeft();
+    }
+    return m_logoWidget->mapTo(this, QPoint(0, 0));
 }
 
-void SplashScreenWidget::setStyleSheetPath(const QString &qssPath)
+QPoint SplashScreenWidget::companyLogoAnchor() const
 {
-    loadStyleSheet(qssPath);
+    if (m_flatRenderer) {
+        return m_flatRenderer->companyLogoRect().topLeft();
+    }
+
+    // The label centers its pixmap
+    const QPixmap pixmap = m_companyLogoLabel->pixmap();
+    const QSize imageSize = pixmap.isNull() ? QSize() : pixmap.deviceIndependentSize().toSize();
+    const QPoint inset((m_companyLogoLabel->width() - imageSize.width()) / 2,
+                       (m_companyLogoLabel->height() - imageSize.height()) / 2);
+    return m_companyLogoLabel->mapTo(this, inset);
 }
 
-void SplashScreenWidget::loadStyleSheet(const QString &path)
+void SplashScreenWidget::updateBakedShadows(qreal devicePixelRatio)
 {
-    QFile styleFile(path);
-    if (styleFile.open(QFile::ReadOnly | QFile::Text)) {
-        QString styleSheet = QString::fromUtf8(styleFile.readAll());
-        setStyleSheet(styleSheet);
-        styleFile.close();
-        qDebug() << "SplashScreen: Stylesheet loaded from" << path;
-    } else {
-        qWarning() << "SplashScreen: Could not load stylesheet:" << path;
+    m_logoShadow.anchor = logoAnchor();
+    m_companyLogoShadow.anchor = companyLogoAnchor();
+
+    // App logo: raster at the painting DPR (re-fetched if the screen changed)
+    updateLogoImage(devicePixelRatio);
+    const QString logoKey = QString("%1|%2x%3|%4").arg(m_logoPath)
+                                .arg(m_logoSize.width()).arg(m_logoSize.height())
+                                .arg(devicePixelRatio);
+    if (m_logoShadow.key != logoKey) {
+        m_logoShadow.key = logoKey;
+        m_logoShadow.shadow = SplashShadowRenderer::Shadow();
+        if (!m_logoImage.isNull()) {
+            m_logoShadow.shadow = SplashShadowRenderer::renderShadow(
+                m_logoImage, LOGO_SHADOW_BLUR, QColor(0, 0, 0, LOGO_SHADOW_ALPHA));
+        }
+    }
+
+    // Company logo: reuse the label pixmap
+    const QString companyKey = QString("%1|%2x%3|%4").arg(m_companyLogoPath)
+                                   .arg(m_companyLogoSize.width()).arg(m_companyLogoSize.height())
+                                   .arg(devicePixelRatio);
+    if (m_companyLogoShadow.key != companyKey) {
+        m_companyLogoShadow.key = companyKey;
+        m_companyLogoShadow.shadow = SplashShadowRenderer::Shadow();
+        const QPixmap pixmap = m_flatRenderer ? m_flatRenderer->companyLogo()
+                                              : m_companyLogoLabel->pixmap();
+        if (!pixmap.isNull()) {
+            m_companyLogoShadow.shadow = SplashShadowRenderer::renderShadow(
+                pixmap.toImage(), COMPANY_SHADOW_BLUR, QColor(0, 0, 0, COMPANY_SHADOW_ALPHA));
+        }
     }
 }
 
-void SplashScreenWidget::setBackgroundColor(const QColor &color)
+void SplashScreenWidget::setWindowMode(WindowMode mode)
 {
-    m_backgroundColor = color;
-    update();
+    if (testAttribute(Qt::WA_WState_Created)) {
+        qWarning() << "SplashScreen: window mode must be set before the splash is shown";
+        return;
+    }
+    m_windowMode = mode;
+    applyWindowMode();
 }
 
-void SplashScreenWidget::setWindowSize(const QSize &size)
+void SplashScreenWidget::applyWindowMode()
 {
-    m_windowSize = size;
-    setFixedSize(size);
+    m_opaqueMasked = (m_windowMode == WindowMode::OpaqueMasked)
+                     || (m_windowMode == WindowMode::Auto
+                         && (!SplashDisplayProbe::hasCompositor()
+                             || SplashDisplayProbe::isConstrained()));
+
+    // Opaque: the cached background covers every pixel, so skip the
+    // system background fill as well
+    setAttribute(Qt::WA_TranslucentBackground, !m_opaqueMasked);
+    setAttribute(Qt::WA_OpaquePaintEvent, m_opaqueMasked);
+    setAttribute(Qt::WA_NoSystemBackground, m_opaqueMasked);
+
+    applyRoundedMask();
+    invalidateBackgroundCache();
 }
 
-void SplashScreenWidget::setBorderRadius(int radius)
+void SplashScreenWidget::applyRoundedMask()
 {
-    m_borderRadius = radius;
-    update();
+    if (!m_opaqueMasked) {
+        if (!m_maskRegion.isEmpty()) {
+            clearMask();
+            m_maskRegion = QRegion();
+        }
+        return;
+    }
+
+    // Region building is costly: only redo it for a new size or radius
+    if (m_maskRegion.isEmpty() || m_maskSize != size() || m_maskRadius != m_borderRadius) {
+        QPainterPath path;
+        path.addRoundedRect(rect(), m_borderRadius, m_borderRadius);
+        m_maskRegion = QRegion(path.toFillPolygon().toPolygon());
+        m_maskSize = size();
+        m_maskRadius = m_borderRadius;
+        setMask(m_maskRegion);
+    }
 }
 
-void SplashScreenWidget::setBorderColor(const QColor &color)
+void SplashScreenWidget::resizeEvent(QResizeEvent *event)
 {
-    m_borderColor = color;
-    update();
+    QWidget::resizeEvent(event);
+    applyRoundedMask();
 }
 
-void SplashScreenWidget::setBorderWidth(int width)
+void SplashScreenWidget::beginUpdate()
 {
-    m_borderWidth = (width < 0) ? 0 : width;
-    update();
+    ++m_updateDepth;
 }
 
-void SplashScreenWidget::setBorderColorRgb(const QString &rgbHex)
+void SplashScreenWidget::endUpdate()
 {
-    QString hex = rgbHex.trimmed();
-    if (hex.startsWith('#')) {
-        hex.remove(0, 1);
+    if (m_updateDepth == 0) {
+        qWarning() << "SplashScreen: endUpdate() without beginUpdate()";
+        return;
     }
-
-    if (hex.size() != 6) {
-        qWarning() << "SplashScreen: Border color RGB hex must be 6 digits (RRGGBB):" << rgbHex;
+    if (--m_updateDepth > 0) {
         return;
     }
-
-    QColor color(QString('#') + hex);
-    if (!color.isValid()) {
-        qWarning() << "SplashScreen: Invalid RGB hex for border color:" << rgbHex;
+    if (m_released) {
+        // Nothing left to apply the batch to
+        m_geometryDirty = false;
+        m_logoDirty = false;
+        m_companyLogoDirty = false;
+        m_deferredStyleSheetPath.clear();
+        m_deferredStyleSheet.clear();
         return;
     }
 
-    setBorderColor(color);
-}
-
-void SplashScreenWidget::setTotalSteps(int steps)
-{
-    m_totalSteps = steps;
-    m_progressBar->setMaximum(steps);
-}
+    // Sizes first: rasterization and the stylesheet scope use them
+    if (m_geometryDirty) {
+        m_geometryDirty = false;
+        setFixedSize(m_windowSize);
+        if (m_flatRenderer) {
+            m_flatRenderer->setWindowSize(m_windowSize);
+            m_flatRenderer->setLogoSize(m_logoSize);
+            m_flatRenderer->setCompanyLogoSize(m_companyLogoSize);
+        } else {
+            m_logoWidget->setFixedSize(m_logoSize);
+            m_companyLogoLabel->setFixedSize(m_companyLogoSize);
+        }
+    }
 
-void SplashScreenWidget::setProgressMode(ProgressMode mode)
-{
-    m_progressMode = mode;
+    if (!m_deferredStyleSheetPath.isEmpty()) {
+        const QString path = m_deferredStyleSheetPath;
+        m_deferredStyleSheetPath.clear();
+        if (m_deferredStyleSheetAsync) {
+            setStyleSheetPathAsync(path);
+        } else {
+            setStyleSheetPath(path);
+        }
+    } else if (!m_deferredStyleSheet.isNull()) {
+        const QString styleSheet = m_deferredStyleSheet;
+        m_deferredStyleSheet.clear();
+        applyStyleSheet(styleSheet);
+    }
 
-    if (mode == ProgressMode::Indeterminate) {
-        m_progressBar->setMaximum(100);
-        m_progressBar->setValue(0);
-    } else {
-        m_progressBar->setMaximum(m_totalSteps);
-        m_progressBar->setValue(m_currentStep);
+    if (m_logoDirty) {
+        m_logoDirty = false;
+        if (m_logoPending) {
+            setLogoPathAsync(m_logoPath);
+        } else {
+            m_logoImage = QImage();
+            updateLogoImage(devicePixelRatioF());
+            if (!m_logoPath.isEmpty() && m_logoImage.isNull()) {
+                qWarning() << "SplashScreen: Invalid SVG for logo:" << m_logoPath;
+            }
+            m_logoShadow.key.clear();
+        }
     }
-}
 
-void SplashScreenWidget::setAppName(const QString &name)
-{
-    m_appNameLabel->setText(name);
-}
+    if (m_companyLogoDirty) {
+        m_companyLogoDirty = false;
+        if (m_companyLogoPending) {
+            setCompanyLogoPathAsync(m_companyLogoPath);
+        } else if (!m_companyLogoPath.isEmpty()) {
+            updateCompanyLogoPixmap();
+        }
+    }
 
-void SplashScreenWidget::setAppVersion(const QString &version)
-{
-    m_appVersionLabel->setText(version);
+    invalidateBackgroundCache();
 }
 
-void SplashScreenWidget::setCompanyName(const QString &name)
+void SplashScreenWidget::setLogoPath(const QString &svgPath)
 {
-    m_companyNameLabel->setText(name);
+    if (m_released) {
+        return;
+    }
+    if (QFile::exists(svgPath)) {
+        ++m_logoGeneration;
+        m_logoPending = false;
+        m_logoFromBundle = false;
+        m_logoPath = svgPath;
+        if (m_updateDepth > 0) {
+            m_logoDirty = true;
+            return;
+        }
+        m_logoImage = QImage();
+        updateLogoImage(devicePixelRatioF());
+        if (m_logoImage.isNull()) {
+            qWarning() << "SplashScreen: Invalid SVG for logo:" << svgPath;
+        }
+        m_logoShadow.key.clear();
+        invalidateBackgroundCache();
+    } else {
+        qWarning() << "SplashScreen: Logo file not found:" << svgPath;
+    }
 }
 
-void SplashScreenWidget::setCompanyLogoPath(const QString &svgPath)
+void SplashScreenWidget::setLogoSize(const QSize &size)
 {
-    m_companyLogoPath = svgPath;
-    updateCompanyLogoPixmap();
+    if (m_released) {
+        return;
+    }
+    m_logoSize = size;
+    if (m_updateDepth > 0) {
+        m_geometryDirty = true;
+        m_logoDirty = true;
+        return;
+    }
+    if (m_flatRenderer) {
+        m_flatRenderer->setLogoSize(size);
+    } else {
+        m_logoWidget->setFixedSize(size);
+    }
+    if (m_logoPending) {
+        // Re-rasterize at the new size in the background
+        setLogoPathAsync(m_logoPath);
+        return;
+    }
+    m_logoImage = QImage();
+    updateLogoImage(devicePixelRatioF());
+    invalidateBackgroundCache();
 }
 
-void SplashScreenWidget::setCompanyLogoSize(const QSize &size)
+void SplashScreenWidget::setLogoCacheDirectory(const QString &path)
 {
-    m_companyLogoSize = size;
-    m_companyLogoLabel->setFixedSize(size);
-    updateCompanyLogoPixmap();
+    m_logoCache.setDirectory(path);
 }
 
-void SplashScreenWidget::updateCompanyLogoPixmap()
+void SplashScreenWidget::updateLogoImage(qreal devicePixelRatio)
 {
-    if (m_companyLogoPath.isEmpty()) {
-        m_companyLogoLabel->clear();
+    if ((m_logoPath.isEmpty() && !m_logoFromBundle) || m_logoPending) {
+        return;
+    }
+    if (!m_logoImage.isNull() && qFuzzyCompare(m_logoImage.devicePixelRatio(), devicePixelRatio)) {
         return;
     }
 
-    if (!QFile::exists(m_companyLogoPath)) {
-        qWarning() << "SplashScreen: Company logo file not found:" << m_companyLogoPath;
-        m_companyLogoLabel->clear();
+    if (m_logoFromBundle) {
+        applyLogoImage(m_assetBundle->image("logo", devicePixelRatio));
         return;
     }
+    ++m_updateStats.rasterizations;
+    applyLogoImage(m_logoCache.image(m_logoPath, m_logoSize, devicePixelRatio));
+}
 
-    if (m_companyLogoPath.endsWith(".svg", Qt::CaseInsensitive)) {
-        QSvgRenderer renderer(m_companyLogoPath);
-        if (!renderer.isValid()) {
-            qWarning() << "SplashScreen: Invalid SVG for company logo:" << m_companyLogoPath;
-            m_companyLogoLabel->clear();
-            return;
-        }
-        QPixmap pixmap(m_companyLogoSize);
-        pixmap.fill(Qt::transparent);
-        QPainter painter(&pixmap);
-        renderer.render(&painter);
-        m_companyLogoLabel->setPixmap(pixmap);
+void SplashScreenWidget::applyLogoImage(const QImage &image)
+{
+    if (m_released) {
+        return;
+    }
+    m_logoImage = image;
+    if (m_flatRenderer) {
+        m_flatRenderer->setLogo(m_logoImage);
     } else {
-        QPixmap pixmap(m_companyLogoPath);
-        if (pixmap.isNull()) {
-            qWarning() << "SplashScreen: Invalid image for company logo:" << m_companyLogoPath;
-            m_companyLogoLabel->clear();
-            return;
-        }
-        m_companyLogoLabel->setPixmap(pixmap.scaled(m_companyLogoSize, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+        m_logoWidget->setPixmap(QPixmap::fromImage(m_logoImage));
     }
 }
 
-void SplashScreenWidget::setProgress(int step)
+void SplashScreenWidget::setLogoPathAsync(const QString &svgPath)
 {
-    m_currentStep = qBound(0, step, m_totalSteps);
-
-    if (m_progressMode == ProgressMode::Determinate) {
-        m_progressBar->setValue(m_currentStep);
-        emit progressChanged(m_currentStep, m_totalSteps);
+    if (m_released) {
+        return;
+    }
+    m_logoPath = svgPath;
+    m_logoFromBundle = false;
+    m_logoPending = true;
+    if (m_updateDepth > 0) {
+        ++m_logoGeneration;  // Drop a load already in flight
+        m_logoDirty = true;
+        return;
     }
+    applyLogoImage(QImage());
+    m_logoShadow.key.clear();
+    invalidateBackgroundCache();
+
+    const int generation = ++m_logoGeneration;
+    const SplashLogoCache cache = m_logoCache;
+    const QSize size = m_logoSize;
+    const qreal dpr = devicePixelRatioF();
+
+    ++m_updateStats.rasterizations;
+    beginAssetLoad();
+    auto *watcher = new QFutureWatcher<QImage>(this);
+    connect(watcher, &QFutureWatcher<QImage>::finished, this, [this, watcher, generation, svgPath]() {
+        const QImage image = watcher->result();
+        watcher->deleteLater();
+        if (generation == m_logoGeneration) {
+            m_logoPending = false;
+            if (image.isNull()) {
+                qWarning() << "SplashScreen: Invalid SVG for logo:" << svgPath;
+            }
+            applyLogoImage(image);
+            m_logoShadow.key.clear();
+            invalidateBackgroundCache();
+        }
+        endAssetLoad();
+    });
+    watcher->setFuture(QtConcurrent::run([cache, svgPath, size, dpr]() {
+        return cache.image(svgPath, size, dpr);
+    }));
 }
 
-void SplashScreenWidget::incrementProgress()
+void SplashScreenWidget::setCompanyLogoPathAsync(const QString &path)
 {
-    setProgress(m_currentStep + 1);
+    if (m_released) {
+        return;
+    }
+    m_companyLogoPath = path;
+    m_companyLogoPending = true;
+    if (m_updateDepth > 0) {
+        ++m_companyLogoGeneration;
+        m_companyLogoDirty = true;
+        return;
+    }
+    showCompanyLogo(QPixmap());
+    m_companyLogoShadow.key.clear();
+    invalidateBackgroundCache();
+
+    const int generation = ++m_companyLogoGeneration;
+    const SplashLogoCache cache = m_logoCache;
+    const QSize size = m_companyLogoSize;
+    const qreal dpr = devicePixelRatioF();
+
+    ++m_updateStats.rasterizations;
+    beginAssetLoad();
+    auto *watcher = new QFutureWatcher<QImage>(this);
+    connect(watcher, &QFutureWatcher<QImage>::finished, this, [this, watcher, generation]() {
+        const QImage image = watcher->result();
+        watcher->deleteLater();
+        if (generation == m_companyLogoGeneration) {
+            m_companyLogoPending = false;
+            showCompanyLogo(image.isNull() ? QPixmap() : QPixmap::fromImage(image));
+            m_companyLogoShadow.key.clear();
+            invalidateBackgroundCache();
+        }
+        endAssetLoad();
+    });
+    watcher->setFuture(QtConcurrent::run([cache, path, size, dpr]() {
+        return loadCompanyLogoImage(cache, path, size, dpr);
+    }));
 }
 
-void SplashScreenWidget::setStatusMessage(const QString &message)
+void SplashScreenWidget::setStyleSheetPathAsync(const QString &qssPath)
 {
-    m_statusLabel->setText(message);
-    QApplication::processEvents();
+    if (m_released) {
+        return;
+    }
+    m_styleSheetPath = qssPath;
+    const int generation = ++m_styleGeneration;
+    if (m_updateDepth > 0) {
+        m_deferredStyleSheetPath = qssPath;
+        m_deferredStyleSheetAsync = true;
+        m_deferredStyleSheet.clear();
+        return;
+    }
+    // Flat mode has no child tree to prune against
+    const bool prune = m_pruneStyleSheets && !m_flatRenderer;
+    const SplashStyleSheetCache cache = m_styleSheetCache;
+    const SplashStyleSheetCache::Scope scope = prune ? SplashStyleSheetCache::scopeOf(this)
+                                                     : SplashStyleSheetCache::Scope();
+
+    beginAssetLoad();
+    auto *watcher = new QFutureWatcher<QString>(this);
+    connect(watcher, &QFutureWatcher<QString>::finished, this, [this, watcher, generation, qssPath]() {
+        const QString styleSheet = watcher->result();
+        watcher->deleteLater();
+        if (generation == m_styleGeneration && !styleSheet.isNull()) {
+            applyStyleSheet(styleSheet);
+            qDebug() << "SplashScreen: Stylesheet loaded from" << qssPath;
+        }
+        endAssetLoad();
+    });
+    watcher->setFuture(QtConcurrent::run([qssPath, prune, cache, scope]() {
+        return prune ? cache.load(qssPath, scope) : readStyleSheet(qssPath);
+    }));
 }
 
-void SplashScreenWidget::startSplash()
+bool SplashScreenWidget::setAssetBundle(const QString &path)
 {
-    m_elapsedTimer.start();
-    m_minimumDurationElapsed = false;
-    m_finishRequested = false;
-    m_isClosed = false;
+    if (m_released) {
+        return false;
+    }
+    auto bundle = std::make_unique<SplashAssetBundle>();
+    if (!bundle->open(path)) {
+        qWarning() << "SplashScreen: Could not open asset bundle:" << path;
+        return false;
+    }
 
-    // Center on screen
-    if (QScreen *screen = QGuiApplication::primaryScreen()) {
-        QRect screenGeometry = screen->availableGeometry();
-        int x = (screenGeometry.width() - width()) / 2;
-        int y = (screenGeometry.height() - height()) / 2;
-        move(screenGeometry.x() + x, screenGeometry.y() + y);
+    // Drop views into a previous mapping before it is unmapped
+    if (m_logoFromBundle) {
+        applyLogoImage(QImage());
+    }
+    m_assetBundle = std::move(bundle);
+
+    const QJsonObject metadata = m_assetBundle->metadata();
+    auto sizeFromMetadata = [&metadata](const char *key) {
+        const QJsonArray values = metadata.value(QLatin1String(key)).toArray();
+        return (values.size() == 2) ? QSize(values[0].toInt(), values[1].toInt()) : QSize();
+    };
+
+    if (m_assetBundle->contains("logo")) {
+        ++m_logoGeneration;
+        m_logoPending = false;
+        m_logoPath.clear();
+        m_logoFromBundle = true;
+        m_logoImage = QImage();
+        m_logoShadow.key.clear();
+        const QSize size = sizeFromMetadata("logoSize");
+        if (size.isValid()) {
+            setLogoSize(size);
+        } else {
+            updateLogoImage(devicePixelRatioF());
+        }
     }
 
-    show();
-    raise();
-    activateWindow();
+    if (m_assetBundle->contains("companyLogo")) {
+        ++m_companyLogoGeneration;
+        m_companyLogoPending = false;
+        m_companyLogoPath.clear();
+        const QSize size = sizeFromMetadata("companyLogoSize");
+        if (size.isValid()) {
+            setCompanyLogoSize(size);
+        }
+        showCompanyLogo(QPixmap::fromImage(m_assetBundle->image("companyLogo", devicePixelRatioF())));
+        m_companyLogoShadow.key.clear();
+    }
 
-    // Start bouncing animation if in indeterminate mode
-    if (m_progressMode == ProgressMode::Indeterminate) {
-        startBouncingAnimation();
+    const QByteArray styleSheet = m_assetBundle->data("style");
+    if (!styleSheet.isNull()) {
+        ++m_styleGeneration;
+        if (m_updateDepth > 0) {
+            // Polished once in endUpdate(), like a stylesheet path
+            m_deferredStyleSheet = QString::fromUtf8(styleSheet);
+            m_deferredStyleSheetPath.clear();
+        } else {
+            applyStyleSheet(QString::fromUtf8(styleSheet));
+        }
     }
 
-    // Timer for minimum duration
-    QTimer::singleShot(m_minimumDisplayDuration, this, &SplashScreenWidget::onMinimumDurationElapsed);
+    invalidateBackgroundCache();
+    return true;
+}
 
-    QApplication::processEvents();
+void SplashScreenWidget::beginAssetLoad()
+{
+    ++m_pendingAssets;
 }
 
-void SplashScreenWidget::finishSplash()
+void SplashScreenWidget::endAssetLoad()
 {
-    m_finishRequested = true;
-    checkAndClose();
+    if (--m_pendingAssets == 0) {
+        emit assetsLoaded();
+        if (m_waitingForAssets) {
+            m_waitingForAssets = false;
+            showWindowIfReady();
+        } else {
+            scheduleSnapshotHandOff();
+        }
+    }
 }
 
-bool SplashScreenWidget::isReadyToClose() const
+void SplashScreenWidget::adoptSnapshot(SplashSnapshotWindow *window)
 {
-    return m_minimumDurationElapsed && m_finishRequested;
+    m_snapshotWindow.reset(window);
 }
 
-void SplashScreenWidget::setProgressPosition(int pos)
+void SplashScreenWidget::setSnapshotPath(const QString &path)
 {
-    m_progressPosition = pos;
-    if (m_progressMode == ProgressMode::Indeterminate) {
-        m_progressBar->setValue(pos);
+    m_snapshotPath = path;
+}
+
+void SplashScreenWidget::scheduleSnapshotHandOff()
+{
+    // Queued: runs after the pending expose/paint has been flushed
+    if (isVisible() && m_pendingAssets == 0) {
+        QTimer::singleShot(0, this, &SplashScreenWidget::handOffSnapshot);
     }
 }
 
-void SplashScreenWidget::onMinimumDurationElapsed()
+void SplashScreenWidget::handOffSnapshot()
 {
-    m_minimumDurationElapsed = true;
-    checkAndClose();
+    if (m_snapshotWindow) {
+        m_snapshotWindow->hide();
+        m_snapshotWindow.reset();
+    }
+    captureSnapshot();
 }
 
-void SplashScreenWidget::updateBouncingProgress()
+QString SplashScreenWidget::snapshotKey() const
 {
-    m_progressPosition += BOUNCE_STEP * m_bounceDirection;
+    // What the composed image depends on. Files count by identity (path,
+    // size, modification time), so nothing is read here.
+    QStringList parts;
+    auto addFile = [&parts](const QString &path) {
+        const QFileInfo info(path);
+        parts << path << QString::number(info.size())
+              << QString::number(info.lastModified().toMSecsSinceEpoch());
+    };
+    parts << QString::number(m_windowSize.width()) << QString::number(m_windowSize.height())
+          << QString::number(devicePixelRatioF()) << QCoreApplication::applicationVersion()
+          << QString::number(static_cast<int>(m_renderMode));
+    if (m_flatRenderer) {
+        parts << m_flatRenderer->appName() << m_flatRenderer->appVersion()
+              << m_flatRenderer->companyName();
+    } else if (!m_released) {
+        parts << m_appNameLabel->text() << m_appVersionLabel->text() << m_companyNameLabel->text();
+    }
+    parts << QString::number(m_logoSize.width()) << QString::number(m_logoSize.height())
+          << QString::number(m_companyLogoSize.width()) << QString::number(m_companyLogoSize.height())
+          << QString::number(m_borderRadius) << QString::number(m_borderWidth)
+          << m_borderColor.name(QColor::HexArgb) << m_backgroundColor.name(QColor::HexArgb);
+    addFile(m_styleSheetPath);
+    addFile(m_logoPath);
+    addFile(m_companyLogoPath);
+    addFile(m_assetBundle ? m_assetBundle->fileName() : QString());
+
+    const QByteArray hash = QCryptographicHash::hash(parts.join(QChar(0)).toUtf8(),
+                                                     QCryptographicHash::Sha1);
+    return QString::fromLatin1(hash.toHex());
+}
 
-    if (m_progressPosition >= 100) {
-        m_progressPosition = 100;
-        m_bounceDirection = -1;
-    } else if (m_progressPosition <= 0) {
-        m_progressPosition = 0;
-        m_bounceDirection = 1;
+void SplashScreenWidget::captureSnapshot()
+{
+    if (m_snapshotPath.isEmpty() || !m_snapshotImage.isNull()
+        || m_pendingAssets > 0 || !isVisible() || m_isClosed) {
+        return;
     }
 
-    m_progressBar->setValue(m_progressPosition);
+    QImage image = grab().toImage().convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    if (m_opaqueMasked) {
+        // Keep the window shape: the snapshot window masks on alpha
+        QPainter painter(&image);
+        painter.setCompositionMode(QPainter::CompositionMode_Clear);
+        painter.setClipRegion(QRegion(rect()).subtracted(m_maskRegion));
+        painter.fillRect(rect(), Qt::transparent);
+    }
+    m_snapshotImage = image;
 }
 
-void SplashScreenWidget::startBouncingAnimation()
+void SplashScreenWidget::setStyleSheetPruning(bool enabled)
 {
-    m_progressPosition = 0;
-    m_bounceDirection = 1;
-    m_bounceTimer->start(BOUNCE_INTERVAL_MS);
+    m_pruneStyleSheets = enabled;
 }
 
-void SplashScreenWidget::stopBouncingAnimation()
+void SplashScreenWidget::setStyleSheetCacheDirectory(const QString &path)
 {
-    if (m_bounceTimer) {
-        m_bounceTimer->stop();
-    }
+    m_styleSheetCache.setDirectory(path);
 }
 
-void SplashScreenWidget::checkAndClose()
+void SplashScreenWidget::setMinimumDisplayDuration(int milliseconds)
 {
-    if (m_minimumDurationElapsed && m_finishRequested && !m_isClosed) {
-        m_isClosed = true;
-        stopBouncingAnimation();
+    m_minimumDisplayDuration = milliseconds;
+}
 
-        // Complete the progress bar before closing
-        if (m_progressMode == ProgressMode::Determinate) {
-            m_progressBar->setValue(m_totalSteps);
+void SplashScreenWidget::setShowDelay(int milliseconds)
+{
+    m_showDelay = qMax(0, milliseconds);
+}
+
+void SplashScreenWidget::setClosingDelay(int milliseconds)
+{
+    m_closingDelay = qMax(0, milliseconds);
+}
+
+void SplashScreenWidget::setStyleSheetPath(const QString &qssPath)
+{
+    if (m_released) {
+        return;
+    }
+    m_styleSheetPath = qssPath;
+    ++m_styleGeneration;
+    if (m_updateDepth > 0) {
+        m_deferredStyleSheetPath = qssPath;
+        m_deferredStyleSheetAsync = false;
+        m_deferredStyleSheet.clear();
+        return;
+    }
+    loadStyleSheet(qssPath);
+}
+
+void SplashScreenWidget::loadStyleSheet(const QString &path)
+{
+    // Pruned to the rules this widget tree can match (cached per file hash);
+    // flat mode has no child tree to prune against
+    const QString styleSheet = (m_pruneStyleSheets && !m_flatRenderer)
+                                   ? m_styleSheetCache.load(path, SplashStyleSheetCache::scopeOf(this))
+                                   : readStyleSheet(path);
+    if (!styleSheet.isNull()) {
+        applyStyleSheet(styleSheet);
+        qDebug() << "SplashScreen: Stylesheet loaded from" << path;
+    }
+}
+
+void SplashScreenWidget::applyStyleSheet(const QString &styleSheet)
+{
+    if (m_flatRenderer) {
+        // No widgets to polish: the renderer takes the theme colors
+        m_flatRenderer->applyStyleSheet(styleSheet);
+        invalidateBackgroundCache();
+        update();
+        return;
+    }
+    ++m_updateStats.polishes;
+    setStyleSheet(styleSheet);
+}
+
+QString SplashScreenWidget::readStyleSheet(const QString &path)
+{
+    QFile styleFile(path);
+    if (!styleFile.open(QFile::ReadOnly | QFile::Text)) {
+        qWarning() << "SplashScreen: Could not load stylesheet:" << path;
+        return QString();
+    }
+    return QString::fromUtf8(styleFile.readAll());
+}
+
+void SplashScreenWidget::setBackgroundColor(const QColor &color)
+{
+    m_backgroundColor = color;
+    invalidateBackgroundCache();
+}
+
+void SplashScreenWidget::setWindowSize(const QSize &size)
+{
+    if (m_released) {
+        return;
+    }
+    m_windowSize = size;
+    if (m_updateDepth > 0) {
+        m_geometryDirty = true;
+        return;
+    }
+    setFixedSize(size);
+    if (m_flatRenderer) {
+        m_flatRenderer->setWindowSize(size);
+    }
+    invalidateBackgroundCache();
+}
+
+void SplashScreenWidget::setBorderRadius(int radius)
+{
+    if (m_released) {
+        return;
+    }
+    m_borderRadius = radius;
+    applyRoundedMask();
+    invalidateBackgroundCache();
+}
+
+void SplashScreenWidget::setBorderColor(const QColor &color)
+{
+    m_borderColor = color;
+    invalidateBackgroundCache();
+}
+
+void SplashScreenWidget::setBorderWidth(int width)
+{
+    m_borderWidth = (width < 0) ? 0 : width;
+    invalidateBackgroundCache();
+}
+
+void SplashScreenWidget::setBorderColorRgb(const QString &rgbHex)
+{
+    QString hex = rgbHex.trimmed();
+    if (hex.startsWith('#')) {
+        hex.remove(0, 1);
+    }
+
+    if (hex.size() != 6) {
+        qWarning() << "SplashScreen: Border color RGB hex must be 6 digits (RRGGBB):" << rgbHex;
+        return;
+    }
+
+    QColor color(QString('#') + hex);
+    if (!color.isValid()) {
+        qWarning() << "SplashScreen: Invalid RGB hex for border color:" << rgbHex;
+        return;
+    }
+
+    setBorderColor(color);
+}
+
+void SplashScreenWidget::setTotalSteps(int steps)
+{
+    m_totalSteps = steps;
+    setBarMaximum(progressMaximum());
+}
+
+void SplashScreenWidget::setProgressMode(ProgressMode mode)
+{
+    if (m_released) {
+        return;
+    }
+    m_progressMode = mode;
+    if (m_flatRenderer) {
+        m_flatRenderer->setIndeterminate(mode == ProgressMode::Indeterminate);
+        update(m_flatRenderer->progressRect());
+    } else {
+        m_progressBar->setVisible(mode == ProgressMode::Determinate);
+        m_progressIndicator->setVisible(mode == ProgressMode::Indeterminate);
+    }
+
+    if (mode == ProgressMode::Indeterminate) {
+        setBarMaximum(100);
+        setBarValue(0);
+        if (isVisible() && !m_isClosed) {
+            startIndeterminateAnimation();
+        }
+    } else if (isDurationWeighted()) {
+        stopIndeterminateAnimation();
+        setBarMaximum(WEIGHTED_RESOLUTION);
+        setBarValue(qRound(m_weightedFraction * WEIGHTED_RESOLUTION));
+    } else {
+        stopIndeterminateAnimation();
+        setBarMaximum(progressMaximum());
+        setBarValue(m_appliedSubStepValue);
+    }
+}
+
+void SplashScreenWidget::setBarMaximum(int maximum)
+{
+    if (m_released) {
+        return;
+    }
+    if (!m_flatRenderer) {
+        m_progressBar->setMaximum(maximum);
+    } else if (m_flatRenderer->setMaximum(maximum)) {
+        update(m_flatRenderer->progressRect());
+    }
+}
+
+void SplashScreenWidget::setBarValue(int value)
+{
+    if (m_released) {
+        return;
+    }
+    if (!m_flatRenderer) {
+        m_progressBar->setValue(value);
+    } else if (m_flatRenderer->setValue(value)) {
+        update(m_flatRenderer->progressRect());
+    }
+}
+
+int SplashScreenWidget::progressMaximum() const
+{
+    if (m_progressMode == ProgressMode::Indeterminate) {
+        return 100;
+    }
+    return isDurationWeighted() ? WEIGHTED_RESOLUTION : m_totalSteps * SUB_STEP_RESOLUTION;
+}
+
+bool SplashScreenWidget::isDurationWeighted() const
+{
+    return !m_steps.isEmpty();
+}
+
+void SplashScreenWidget::setTimingHistoryPath(const QString &path)
+{
+    m_timingHistory.setFilePath(path);
+    m_timingHistoryLoaded = false;
+}
+
+void SplashScreenWidget::setShowRemainingTime(bool show)
+{
+    m_showRemainingTime = show;
+    updateStatusLabel();
+}
+
+void SplashScreenWidget::setSteps(const QStringList &names)
+{
+    if (!m_timingHistoryLoaded) {
+        if (m_timingHistory.filePath().isEmpty()) {
+            m_timingHistory.setFilePath(SplashTimingHistory::defaultFilePath());
+        }
+        m_timingHistory.load();
+        m_timingHistoryLoaded = true;
+    }
+
+    // Steps without history are assumed to take as long as the average known step
+    qint64 knownTotal = 0;
+    int knownCount = 0;
+    for (const QString &name : names) {
+        if (m_timingHistory.contains(name)) {
+            knownTotal += m_timingHistory.expectedDuration(name, DEFAULT_STEP_DURATION_MS);
+            knownCount++;
+        }
+    }
+    const qint64 fallback = (knownCount > 0) ? knownTotal / knownCount : DEFAULT_STEP_DURATION_MS;
+
+    m_steps.clear();
+    m_stepIndex.clear();
+    for (const QString &name : names) {
+        const qint64 expected = qMax<qint64>(1, m_timingHistory.expectedDuration(name, fallback));
+        const StepTiming step{name, expected, -1, -1, std::make_shared<std::atomic<int>>(-1)};
+        m_stepIndex.insert(name, m_steps.size());
+        m_steps.append(step);
+    }
+
+    m_weightedFraction = 0.0;
+    m_remainingMs = 0;
+    m_totalSteps = m_steps.size();
+    m_currentStep = 0;
+    setProgressMode(m_progressMode);
+}
+
+void SplashScreenWidget::beginStep(const QString &name)
+{
+    const int index = m_stepIndex.value(name, -1);
+    if (index < 0) {
+        qWarning() << "SplashScreen: beginStep for undeclared step:" << name;
+        return;
+    }
+
+    if (!m_stepClock.isValid()) {
+        m_stepClock.start();
+    }
+    m_steps[index].startedAtMs = m_stepClock.elapsed();
+    m_steps[index].finishedAtMs = -1;
+    m_steps[index].reportedFraction->store(-1, std::memory_order_relaxed);
+
+    if (isVisible() && !m_isClosed) {
+        startFrameTimer();
+    }
+}
+
+void SplashScreenWidget::endStep(const QString &name)
+{
+    const int index = m_stepIndex.value(name, -1);
+    if (index < 0) {
+        qWarning() << "SplashScreen: endStep for undeclared step:" << name;
+        return;
+    }
+
+    StepTiming &step = m_steps[index];
+    if (step.startedAtMs < 0 || step.finishedAtMs >= 0) {
+        return;
+    }
+    step.finishedAtMs = m_stepClock.elapsed();
+
+    int finished = 0;
+    for (const auto &timing : m_steps) {
+        if (timing.finishedAtMs >= 0) {
+            finished++;
+        }
+    }
+    m_currentStep = finished;
+    updateWeightedProgress();
+    emit progressChanged(m_currentStep, m_totalSteps);
+}
+
+void SplashScreenWidget::startFrameTimer()
+{
+    if (!m_frameTimer->isActive()) {
+        m_frameTimer->start(frameTimerInterval());
+    }
+}
+
+int SplashScreenWidget::frameTimerInterval() const
+{
+    switch (m_renderTier) {
+    case RenderTier::Reduced:
+        return REDUCED_FRAME_INTERVAL_MS;
+    case RenderTier::Minimal:
+        return MINIMAL_FRAME_INTERVAL_MS;
+    case RenderTier::Paused:
+        return PAUSED_FRAME_INTERVAL_MS;
+    case RenderTier::Full:
+        break;
+    }
+    return FRAME_INTERVAL_MS;
+}
+
+void SplashScreenWidget::setAdaptiveRendering(bool enabled)
+{
+    m_adaptiveRendering = enabled;
+    m_slowFrameStreak = 0;
+}
+
+void SplashScreenWidget::setFrameBudget(int milliseconds)
+{
+    m_frameBudgetMs = qMax(1, milliseconds);
+}
+
+bool SplashScreenWidget::event(QEvent *event)
+{
+    // An update request paints and flushes the whole window: time it as
+    // the cost of one frame.
+    if (event->type() == QEvent::UpdateRequest) {
+        QElapsedTimer frameClock;
+        frameClock.start();
+        const bool handled = QWidget::event(event);
+        recordFrameCost(frameClock.nsecsElapsed());
+        return handled;
+    }
+
+    if (event->type() == QEvent::WindowStateChange) {
+        updateExposure();
+    } else if (event->type() == QEvent::LayoutRequest) {
+        ++m_updateStats.layouts;
+    }
+    return QWidget::event(event);
+}
+
+bool SplashScreenWidget::eventFilter(QObject *watched, QEvent *event)
+{
+    if (watched == windowHandle() && event->type() == QEvent::Expose) {
+        updateExposure();
+        if (m_exposed) {
+            scheduleSnapshotHandOff();
+        }
+    }
+    return QWidget::eventFilter(watched, event);
+}
+
+void SplashScreenWidget::updateExposure()
+{
+    // QWindow::isExposed() is false when minimized, hidden or (on some
+    // platforms, e.g. Wayland and macOS) fully covered. On X11 and Windows
+    // it stays true for windows covered by others: this is not occlusion
+    // detection there.
+    const QWindow *window = windowHandle();
+    const bool exposed = window && window->isExposed() && !isMinimized();
+    if (exposed != m_exposed) {
+        m_exposed = exposed;
+        applyRenderTier();
+    }
+}
+
+void SplashScreenWidget::recordFrameCost(qint64 nsecs)
+{
+    const qreal ms = nsecs / 1.0e6;
+    m_frameCostMs = (m_frameCostMs > 0.0) ? 0.8 * m_frameCostMs + 0.2 * ms : ms;
+
+    if (!m_adaptiveRendering || m_renderTier == RenderTier::Paused) {
+        return;
+    }
+    if (!m_tierClock.isValid()) {
+        m_tierClock.start();
+    }
+
+    if (m_frameCostMs > m_frameBudgetMs) {
+        if (++m_slowFrameStreak >= SLOW_FRAME_LIMIT && m_performanceTier != RenderTier::Minimal) {
+            // Back off harder on every downgrade so tiers don't oscillate
+            m_upgradeDelayMs = qMin(m_upgradeDelayMs * 2, MAX_TIER_UPGRADE_DELAY_MS);
+            setPerformanceTier(static_cast<RenderTier>(static_cast<int>(m_performanceTier) + 1));
+        }
+        return;
+    }
+
+    m_slowFrameStreak = 0;
+    if (m_frameCostMs < m_frameBudgetMs / 4.0
+        && m_performanceTier != RenderTier::Full
+        && m_tierClock.elapsed() >= m_upgradeDelayMs) {
+        setPerformanceTier(static_cast<RenderTier>(static_cast<int>(m_performanceTier) - 1));
+    }
+}
+
+void SplashScreenWidget::setPerformanceTier(RenderTier tier)
+{
+    m_performanceTier = tier;
+    m_slowFrameStreak = 0;
+    m_frameCostMs = 0.0;
+    m_tierClock.restart();
+    applyRenderTier();
+}
+
+void SplashScreenWidget::applyRenderTier()
+{
+    if (m_released) {
+        return;
+    }
+    const RenderTier tier = m_exposed ? m_performanceTier : RenderTier::Paused;
+    if (tier == m_renderTier) {
+        return;
+    }
+    m_renderTier = tier;
+
+    if (tier != RenderTier::Paused) {
+        const bool flat = (tier == RenderTier::Minimal);
+        if (flat != m_flatChrome) {
+            m_flatChrome = flat;
+            invalidateBackgroundCache();
+        }
+        if (m_flatRenderer) {
+            m_flatRenderer->setFlat(flat);
         } else {
-            m_progressBar->setValue(100);
+            m_progressIndicator->setFlat(flat);
+            m_progressIndicator->setFrameInterval(tier == RenderTier::Full ? 0
+                                                  : tier == RenderTier::Reduced ? REDUCED_FRAME_INTERVAL_MS
+                                                  : MINIMAL_FRAME_INTERVAL_MS);
+        }
+    }
+
+    if (tier == RenderTier::Paused) {
+        stopIndeterminateAnimation();
+    } else if (m_progressMode == ProgressMode::Indeterminate && isVisible() && !m_isClosed) {
+        startIndeterminateAnimation();
+    }
+
+    if (m_frameTimer->isActive()) {
+        m_frameTimer->start(frameTimerInterval());
+    }
+
+    emit renderTierChanged(tier);
+}
+
+SplashStepReporter SplashScreenWidget::stepReporter(const QString &name) const
+{
+    const int index = m_stepIndex.value(name, -1);
+    if (index < 0) {
+        qWarning() << "SplashScreen: stepReporter for undeclared step:" << name;
+        return SplashStepReporter();
+    }
+    return SplashStepReporter(m_steps[index].reportedFraction);
+}
+
+void SplashScreenWidget::onFrameTick()
+{
+    if (m_flatAnimating) {
+        update(m_flatRenderer->advanceChunk(m_flatAnimationClock.elapsed()));
+    }
+    drainProgressChannel();
+}
+
+void SplashScreenWidget::drainProgressChannel()
+{
+    // Constant work per frame: one sequence check and one atomic load
+    QString message;
+    if (m_channel->takeStatus(&message)) {
+        m_statusMessage = message;
+        m_statusDirty = true;
+    }
+    if (m_statusDirty) {
+        m_statusDirty = false;
+        updateStatusLabel();
+    }
+
+    if (isDurationWeighted()) {
+        updateWeightedProgress();
+    } else {
+        applyPendingSubStepProgress();
+    }
+}
+
+void SplashScreenWidget::applyPendingSubStepProgress()
+{
+    int value = m_channel->progressValue();
+    if (value == m_appliedSubStepValue) {
+        return;
+    }
+
+    if (value / SUB_STEP_RESOLUTION >= m_totalSteps) {
+        value = qMax(0, m_totalSteps) * SUB_STEP_RESOLUTION;
+    }
+    m_appliedSubStepValue = value;
+    const int step = value / SUB_STEP_RESOLUTION;
+    const bool stepChanged = (step != m_currentStep);
+    m_currentStep = step;
+
+    if (m_progressMode == ProgressMode::Determinate) {
+        setBarValue(value);
+        if (stepChanged) {
+            emit progressChanged(m_currentStep, m_totalSteps);
+        }
+    }
+}
+
+void SplashScreenWidget::updateWeightedProgress()
+{
+    if (!isDurationWeighted() || !m_stepClock.isValid()) {
+        return;
+    }
+
+    const qint64 now = m_stepClock.elapsed();
+    double total = 0.0;
+    double done = 0.0;
+    qint64 firstStart = -1;
+
+    for (const auto &step : m_steps) {
+        const double expected = static_cast<double>(step.expectedMs);
+        total += expected;
+
+        if (step.startedAtMs < 0) {
+            continue;
+        }
+        if (firstStart < 0 || step.startedAtMs < firstStart) {
+            firstStart = step.startedAtMs;
+        }
+
+        if (step.finishedAtMs >= 0) {
+            done += expected;
+            continue;
+        }
+
+        // Prefer the step's own report when it provides one
+        const int reported = step.reportedFraction->load(std::memory_order_relaxed);
+        if (reported >= 0) {
+            done += expected * reported / SplashStepReporter::RESOLUTION;
+            continue;
+        }
+
+        // Advance linearly up to 90% of the expected time, then approach
+        // (but never reach) the full weight so overruns keep moving slowly.
+        const double elapsed = static_cast<double>(now - step.startedAtMs);
+        const double knee = 0.9 * expected;
+        if (elapsed <= knee) {
+            done += elapsed;
+        } else {
+            const double tail = 0.1 * expected;
+            done += knee + tail * (1.0 - qExp(-(elapsed - knee) / tail));
+        }
+    }
+
+    const double fraction = (total > 0.0) ? qBound(0.0, done / total, 1.0) : 0.0;
+    m_weightedFraction = qMax(m_weightedFraction, fraction);
+
+    // Rate-based estimate: valid whether steps run serially or in parallel
+    int remaining = 0;
+    if (m_weightedFraction >= 1.0) {
+        remaining = 0;
+    } else if (m_weightedFraction > 0.02 && firstStart >= 0) {
+        const double elapsed = static_cast<double>(now - firstStart);
+        remaining = qRound(elapsed * (1.0 - m_weightedFraction) / m_weightedFraction);
+    } else {
+        remaining = qRound(total * (1.0 - m_weightedFraction));
+    }
+
+    const bool secondChanged = (remaining + 999) / 1000 != (m_remainingMs + 999) / 1000;
+    m_remainingMs = remaining;
+    if (secondChanged) {
+        emit remainingTimeChanged(m_remainingMs);
+        updateStatusLabel();
+    }
+
+    if (m_progressMode == ProgressMode::Determinate) {
+        setBarValue(qRound(m_weightedFraction * WEIGHTED_RESOLUTION));
+    }
+}
+
+void SplashScreenWidget::recordStepTimings()
+{
+    if (!isDurationWeighted()) {
+        return;
+    }
+
+    bool recorded = false;
+    for (const auto &step : m_steps) {
+        if (step.startedAtMs >= 0 && step.finishedAtMs >= 0) {
+            m_timingHistory.addSample(step.name, step.finishedAtMs - step.startedAtMs);
+            recorded = true;
+        }
+    }
+    if (recorded) {
+        m_timingHistory.save();
+    }
+}
+
+void SplashScreenWidget::setAppName(const QString &name)
+{
+    if (m_released) {
+        return;
+    }
+    if (m_flatRenderer) {
+        m_flatRenderer->setAppName(name);
+        invalidateBackgroundCache();
+    } else {
+        m_appNameLabel->setText(name);
+    }
+}
+
+void SplashScreenWidget::setAppVersion(const QString &version)
+{
+    if (m_released) {
+        return;
+    }
+    if (m_flatRenderer) {
+        m_flatRenderer->setAppVersion(version);
+        invalidateBackgroundCache();
+    } else {
+        m_appVersionLabel->setText(version);
+    }
+}
+
+void SplashScreenWidget::setCompanyName(const QString &name)
+{
+    if (m_released) {
+        return;
+    }
+    if (m_flatRenderer) {
+        m_flatRenderer->setCompanyName(name);
+        invalidateBackgroundCache();
+    } else {
+        m_companyNameLabel->setText(name);
+    }
+}
+
+void SplashScreenWidget::setCompanyLogoPath(const QString &svgPath)
+{
+    if (m_released) {
+        return;
+    }
+    ++m_companyLogoGeneration;
+    m_companyLogoPending = false;
+    m_companyLogoPath = svgPath;
+    if (m_updateDepth > 0 && !svgPath.isEmpty()) {
+        m_companyLogoDirty = true;
+        return;
+    }
+    updateCompanyLogoPixmap();
+}
+
+void SplashScreenWidget::setCompanyLogoSize(const QSize &size)
+{
+    if (m_released) {
+        return;
+    }
+    m_companyLogoSize = size;
+    if (m_updateDepth > 0) {
+        m_geometryDirty = true;
+        m_companyLogoDirty = true;
+        return;
+    }
+    if (m_flatRenderer) {
+        m_flatRenderer->setCompanyLogoSize(size);
+    } else {
+        m_companyLogoLabel->setFixedSize(size);
+    }
+    if (m_companyLogoPending) {
+        setCompanyLogoPathAsync(m_companyLogoPath);
+        return;
+    }
+    updateCompanyLogoPixmap();
+}
+
+void SplashScreenWidget::updateCompanyLogoPixmap()
+{
+    m_companyLogoShadow.key.clear();
+    invalidateBackgroundCache();
+
+    if (!m_companyLogoPath.isEmpty()) {
+        ++m_updateStats.rasterizations;
+    }
+    const QImage image = loadCompanyLogoImage(m_logoCache, m_companyLogoPath,
+                                              m_companyLogoSize, devicePixelRatioF());
+    showCompanyLogo(image.isNull() ? QPixmap() : QPixmap::fromImage(image));
+}
+
+QImage SplashScreenWidget::loadCompanyLogoImage(const SplashLogoCache &cache, const QString &path,
+                                                const QSize &size, qreal devicePixelRatio)
+{
+    // Reentrant: also runs on worker threads for setCompanyLogoPathAsync()
+    if (path.isEmpty()) {
+        return QImage();
+    }
+
+    if (!QFile::exists(path)) {
+        qWarning() << "SplashScreen: Company logo file not found:" << path;
+        return QImage();
+    }
+
+    if (path.endsWith(".svg", Qt::CaseInsensitive)) {
+        const QImage image = cache.image(path, size, devicePixelRatio);
+        if (image.isNull()) {
+            qWarning() << "SplashScreen: Invalid SVG for company logo:" << path;
         }
+        return image;
+    }
+
+    const QImage image(path);
+    if (image.isNull()) {
+        qWarning() << "SplashScreen: Invalid image for company logo:" << path;
+        return QImage();
+    }
+    return image.scaled(size, Qt::KeepAspectRatio, Qt::SmoothTransformation)
+        .convertToFormat(QImage::Format_ARGB32_Premultiplied);
+}
+
+void SplashScreenWidget::showCompanyLogo(const QPixmap &pixmap)
+{
+    if (m_released) {
+        return;
+    }
+    if (m_flatRenderer) {
+        m_flatRenderer->setCompanyLogo(pixmap);
+    } else if (pixmap.isNull()) {
+        m_companyLogoLabel->clear();
+    } else {
+        m_companyLogoLabel->setPixmap(pixmap);
+    }
+}
+
+void SplashScreenWidget::setProgress(int step)
+{
+    // In duration-weighted mode the bar is driven by beginStep()/endStep()
+    if (isDurationWeighted()) {
+        m_currentStep = qBound(0, step, m_totalSteps);
+        return;
+    }
+
+    if (m_updateMode == UpdateMode::FrameCoalesced) {
+        m_channel->postProgress(qBound(0, step, m_totalSteps), 0.0);
+        return;
+    }
+
+    m_currentStep = qBound(0, step, m_totalSteps);
+
+    m_appliedSubStepValue = m_currentStep * SUB_STEP_RESOLUTION;
+    m_channel->postProgress(m_currentStep, 0.0);
+
+    if (m_progressMode == ProgressMode::Determinate) {
+        setBarValue(m_appliedSubStepValue);
+        emit progressChanged(m_currentStep, m_totalSteps);
+    }
+}
+
+void SplashScreenWidget::setProgress(int step, qreal fraction)
+{
+    // Only touches the channel: safe from any thread, applied by onFrameTick()
+    m_channel->postProgress(step, fraction);
+}
+
+void SplashScreenWidget::incrementProgress()
+{
+    // Include a not-yet-applied coalesced step so repeated calls accumulate
+    const int pendingStep = m_channel->progressValue() / SUB_STEP_RESOLUTION;
+    setProgress(qMax(m_currentStep, pendingStep) + 1);
+}
+
+void SplashScreenWidget::setStatusMessage(const QString &message)
+{
+    m_statusMessage = message;
+
+    if (m_updateMode == UpdateMode::FrameCoalesced) {
+        m_statusDirty = true;
+        return;
+    }
+
+    updateStatusLabel();
+    QApplication::processEvents();
+}
+
+void SplashScreenWidget::setUpdateMode(UpdateMode mode)
+{
+    m_updateMode = mode;
+    if (mode == UpdateMode::Immediate && m_statusDirty) {
+        m_statusDirty = false;
+        updateStatusLabel();
+    }
+}
+
+void SplashScreenWidget::pumpFrame(int maxMilliseconds)
+{
+    if (m_lastPumpTimer.isValid() && m_lastPumpTimer.elapsed() < FRAME_INTERVAL_MS) {
+        return;
+    }
+    m_lastPumpTimer.start();
+
+    drainProgressChannel();
+    if (isVisible()) {
+        repaint();
+    }
+
+    if (maxMilliseconds > 0) {
+        QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents, maxMilliseconds);
+    }
+}
+
+void SplashScreenWidget::updateStatusLabel()
+{
+    QString text = m_statusMessage;
+    if (m_showRemainingTime && isDurationWeighted() && m_remainingMs > 0 && !m_isClosed) {
+        const int seconds = (m_remainingMs + 999) / 1000;
+        text = QString("%1  (~%2 s)").arg(m_statusMessage).arg(seconds);
+    }
+
+    if (m_released) {
+        return;
+    }
+    if (!m_flatRenderer) {
+        m_statusLabel->setText(text);
+    } else if (m_flatRenderer->setStatus(text)) {
+        update(m_flatRenderer->statusRect());
+    }
+}
+
+void SplashScreenWidget::startSplash()
+{
+    if (m_released) {
+        qWarning() << "SplashScreen: cannot start a splash whose resources were released";
+        return;
+    }
+    m_elapsedTimer.start();
+    m_minimumDurationElapsed = false;
+    m_finishRequested = false;
+    m_finishRequestedMs = -1;
+    m_isClosed = false;
+    m_shown = false;
+
+    // Center on screen
+    if (QScreen *screen = QGuiApplication::primaryScreen()) {
+        QRect screenGeometry = screen->availableGeometry();
+        int x = (screenGeometry.width() - width()) / 2;
+        int y = (screenGeometry.height() - height()) / 2;
+        move(screenGeometry.x() + x, screenGeometry.y() + y);
+    }
 
-        setStatusMessage("Ready!");
+    // With a snapshot, the live splash stays hidden until fully composed so
+    // the swap shows no placeholders. Without one, or with assets already
+    // loaded, the live splash shows at once.
+    if (m_snapshotWindow && (m_pendingAssets == 0 || m_snapshotWindow->snapshotSize() != size()
+                             || m_snapshotWindow->key() != snapshotKey())) {
+        // Ready already, or composed from another configuration: showing
+        // it would only end in a visible jump to the live splash
+        m_snapshotWindow.reset();
+    }
+    m_waitingForAssets = (m_snapshotWindow != nullptr);
+
+    // A startup that finishes within the delay never shows the splash and
+    // never waits for the minimum duration, snapshot or not
+    m_waitingForShowDelay = m_showDelay > 0;
+    if (m_waitingForShowDelay) {
+        QTimer::singleShot(m_showDelay, this, &SplashScreenWidget::onShowDelayElapsed);
+    }
+    showWindowIfReady();
+
+    // Start bouncing animation if in indeterminate mode
+    if (m_progressMode == ProgressMode::Indeterminate) {
+        startIndeterminateAnimation();
+    }
+    startFrameTimer();
+
+    if (m_updateMode == UpdateMode::Immediate) {
         QApplication::processEvents();
+    }
+}
+
+void SplashScreenWidget::onShowDelayElapsed()
+{
+    if (!m_waitingForShowDelay || m_isClosed) {
+        return;
+    }
+    m_waitingForShowDelay = false;
+    showWindowIfReady();
+}
+
+void SplashScreenWidget::markShown()
+{
+    if (m_shown) {
+        return;
+    }
+    m_shown = true;
+
+    // The minimum duration counts from the first visible frame
+    QTimer::singleShot(m_minimumDisplayDuration, this, &SplashScreenWidget::onMinimumDurationElapsed);
+}
+
+void SplashScreenWidget::showWindowIfReady()
+{
+    if (m_waitingForShowDelay || m_isClosed) {
+        return;
+    }
+    if (m_waitingForAssets) {
+        // The snapshot stands in until the live splash is fully composed
+        if (m_snapshotWindow && !m_snapshotWindow->isVisible()) {
+            m_snapshotWindow->present();
+            markShown();
+        }
+        return;
+    }
+    if (!isVisible()) {
+        showWindow();
+    }
+}
+
+void SplashScreenWidget::showWindow()
+{
+    markShown();
+    show();
+    raise();
+    activateWindow();
+
+    // Track exposure (minimized / unmapped) to pause rendering
+    if (!m_windowHooked && windowHandle()) {
+        windowHandle()->installEventFilter(this);
+        m_windowHooked = true;
+    }
+}
+
+void SplashScreenWidget::setReleaseResourcesOnFinish(bool enabled)
+{
+    m_releaseOnFinish = enabled;
+}
+
+void SplashScreenWidget::releaseResources()
+{
+    if (m_released) {
+        return;
+    }
+    if (!m_isClosed || isVisible()) {
+        qWarning() << "SplashScreen: resources can only be released after the splash closed";
+        return;
+    }
+    m_released = true;
+
+    stopIndeterminateAnimation();
+    m_frameTimer->stop();
+
+    // Results of loads still in flight are dropped
+    ++m_logoGeneration;
+    ++m_companyLogoGeneration;
+    ++m_styleGeneration;
+
+    // Child widget tree (labels, progress bar, indicator) and layout
+    const QList<QWidget *> children = findChildren<QWidget *>(QString(), Qt::FindDirectChildrenOnly);
+    qDeleteAll(children);
+    delete m_mainLayout;
+    m_mainLayout = nullptr;
+    m_logoWidget = nullptr;
+    m_appNameLabel = nullptr;
+    m_appVersionLabel = nullptr;
+    m_companyNameLabel = nullptr;
+    m_companyLogoLabel = nullptr;
+    m_progressBar = nullptr;
+    m_progressIndicator = nullptr;
+    m_statusLabel = nullptr;
+    m_progressContainer = nullptr;
+    m_companyContainer = nullptr;
+    m_flatRenderer.reset();
+
+    // Rasters; logo views must go before the bundle mapping
+    m_backgroundCache = QPixmap();
+    m_logoImage = QImage();
+    m_logoShadow = BakedShadow();
+    m_companyLogoShadow = BakedShadow();
+    m_snapshotImage = QImage();
+    m_snapshotWindow.reset();
+    m_assetBundle.reset();
+    m_logoFromBundle = false;
+    m_maskRegion = QRegion();
+
+    setStyleSheet(QString());
+    m_steps.clear();
+    m_stepIndex.clear();
+
+    // Native window and its backing store
+    if (m_windowHooked && windowHandle()) {
+        windowHandle()->removeEventFilter(this);
+    }
+    m_windowHooked = false;
+    destroy();
+}
+
+SplashScreenWidget::MemoryFootprint SplashScreenWidget::memoryFootprint() const
+{
+    auto pixmapBytes = [](const QPixmap &pixmap) -> qint64 {
+        return pixmap.isNull() ? 0
+                               : static_cast<qint64>(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+    };
+
+    MemoryFootprint footprint;
+    footprint.pixmapBytes = pixmapBytes(m_backgroundCache);
+    if (m_flatRenderer) {
+        footprint.pixmapBytes += pixmapBytes(m_flatRenderer->companyLogo());
+    } else if (!m_released) {
+        footprint.pixmapBytes += pixmapBytes(m_logoWidget->pixmap());
+        footprint.pixmapBytes += pixmapBytes(m_companyLogoLabel->pixmap());
+    }
+
+    // Logo views into the bundle are counted with the mapping
+    if (!m_logoFromBundle) {
+        footprint.imageBytes += m_logoImage.sizeInBytes();
+    }
+    footprint.imageBytes += m_logoShadow.shadow.image.sizeInBytes();
+    footprint.imageBytes += m_companyLogoShadow.shadow.image.sizeInBytes();
+    footprint.imageBytes += m_snapshotImage.sizeInBytes();
+
+    footprint.mappedBytes = m_assetBundle ? m_assetBundle->mappedSize() : 0;
+    return footprint;
+}
+
+void SplashScreenWidget::finishSplash()
+{
+    if (!m_finishRequested) {
+        recordStepTimings();
+        m_finishRequestedMs = m_elapsedTimer.elapsed();
+    }
+    m_finishRequested = true;
+    checkAndClose();
+}
+
+bool SplashScreenWidget::isReadyToClose() const
+{
+    return m_finishRequested && (m_minimumDurationElapsed || !m_shown);
+}
+
+void SplashScreenWidget::setProgressPosition(int pos)
+{
+    m_progressPosition = qBound(0, pos, 100);
+    if (m_progressMode != ProgressMode::Indeterminate || m_released) {
+        return;
+    }
+    if (m_flatRenderer) {
+        stopIndeterminateAnimation();
+        m_flatRenderer->setComplete(false);
+        update(m_flatRenderer->setChunkPosition(m_progressPosition / 100.0));
+    } else {
+        m_progressIndicator->setPosition(m_progressPosition / 100.0);
+    }
+}
+
+void SplashScreenWidget::onMinimumDurationElapsed()
+{
+    m_minimumDurationElapsed = true;
+    checkAndClose();
+}
+
+void SplashScreenWidget::startIndeterminateAnimation()
+{
+    if (m_renderTier == RenderTier::Paused) {
+        return;  // Resumed by applyRenderTier() on the next expose
+    }
+    if (m_flatRenderer) {
+        // Advanced by onFrameTick()
+        if (!m_flatAnimating) {
+            m_flatAnimating = true;
+            m_flatRenderer->setComplete(false);
+            m_flatAnimationClock.start();
+        }
+        return;
+    }
+    if (!m_progressIndicator->isRunning()) {
+        m_progressIndicator->start();
+    }
+}
+
+void SplashScreenWidget::stopIndeterminateAnimation()
+{
+    m_flatAnimating = false;
+    if (m_progressIndicator) {
+        m_progressIndicator->stop();
+    }
+}
+
+void SplashScreenWidget::checkAndClose()
+{
+    if (isReadyToClose() && !m_isClosed) {
+        m_isClosed = true;
+        m_waitingForAssets = false;
+        m_waitingForShowDelay = false;
+        stopIndeterminateAnimation();
+        m_frameTimer->stop();
+        m_remainingMs = 0;
+
+        if (!m_shown) {
+            // Finished within the show delay: neither the live window nor
+            // the snapshot was ever shown, nothing to complete
+            m_snapshotWindow.reset();
+            emit splashFinished();
+            close();
+            if (m_releaseOnFinish) {
+                QTimer::singleShot(0, this, &SplashScreenWidget::releaseResources);
+            }
+            return;
+        }
+
+        // Complete the progress bar before closing
+        if (m_progressMode == ProgressMode::Determinate) {
+            setBarValue(progressMaximum());
+        } else if (m_flatRenderer) {
+            m_flatRenderer->setComplete(true);
+            update(m_flatRenderer->progressRect());
+        } else {
+            m_progressIndicator->setComplete(true);
+        }
+
+        if (m_updateMode == UpdateMode::Immediate) {
+            setStatusMessage("Ready!");
+            QApplication::processEvents();
+        } else {
+            // Frame timer is stopped: apply the final state directly
+            m_statusMessage = "Ready!";
+            m_statusDirty = false;
+            updateStatusLabel();
+        }
+
+        // A run that got this far leaves its composed splash for the next
+        // start. Its startup time is when finishSplash() was requested, not
+        // when the splash closed: the latter includes the minimum duration.
+        if (!m_snapshotImage.isNull()) {
+            SplashSnapshotWindow::save(m_snapshotPath, m_snapshotImage, m_opaqueMasked,
+                                       m_finishRequestedMs, snapshotKey());
+        }
 
-        // Small delay to show completion
-        QTimer::singleShot(200, this, [this]() {
+        // Optional delay to show completion
+        QTimer::singleShot(m_closingDelay, this, [this]() {
+            m_snapshotWindow.reset();
             qDebug() << "SplashScreen: emitting splashFinished";
             emit splashFinished();
             close();
+            if (m_releaseOnFinish) {
+                QTimer::singleShot(0, this, &SplashScreenWidget::releaseResources);
+            }
         });
     }
 }
@@ -6,7 +6,6 @@
 #include <QProgressBar>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
-#include <QSvgWidget>
 #include <QTimer>
 #include <QElapsedTimer>
 #include <QPropertyAnimation>
@@ -14,16 +13,44 @@
 #include <QApplication>
 #include <QPainter>
 #include <QPainterPath>
+#include <QPixmap>
+#include <QVector>
+#include <QHash>
+#include <atomic>
+#include <memory>
+
+#include "SplashTimingHistory.h"
+#include "SplashStepReporter.h"
+#include "SplashProgressChannel.h"
+#include "SplashShadowRenderer.h"
+#include "SplashProgressIndicator.h"
+#include "SplashFlatRenderer.h"
+#include "SplashLogoCache.h"
+#include "SplashStyleSheetCache.h"
+#include "SplashAssetBundle.h"
+#include "SplashSnapshotWindow.h"
 
 /**
  * @brief Custom reusable splash screen widget for Qt applications.
  *
  * Features:
- * - SVG logo support
- * - Bouncing progress bar (indeterminate mode)
+ * - SVG logo support, rasterized once and cached on disk
+ * - Damage-limited indeterminate progress indicator ticking at the display refresh rate
  * - Step-based progress bar (determinate mode)
+ * - Duration-weighted progress from persisted per-step timing history
+ * - Fractional sub-step progress, coalesced to one repaint per frame
+ * - Lock-free progress/status channel for worker threads
+ * - Frame-coalesced updates without re-entrant event processing
+ * - Adaptive render tiers for remote, software-rendered and hidden windows
+ * - Opaque masked window mode for displays without a compositor
+ * - Flat render mode: no child widgets, everything drawn in one paintEvent
  * - Status message display
  * - QSS stylesheet loading
+ * - Asynchronous logo/stylesheet loading with placeholders
+ * - Memory-mapped asset bundles (pre-rasterized logos, pruned QSS)
+ * - Snapshot of the composed splash, shown raw on the next start
+ * - Batched configuration: one polish, one rasterization per asset
+ * - Optional release of all resources after the handoff
  * - Minimum display duration
  *
  * SOLID Principles applied:
@@ -41,17 +68,114 @@ public:
      * @brief Progress bar display mode
      */
     enum class ProgressMode {
-        Indeterminate,  ///< Bouncing progress bar
+        Indeterminate,  ///< Sliding indicator, time-based animation
         Determinate     ///< Step-based progress bar
     };
 
+    /**
+     * @brief How status and progress changes reach the screen
+     */
+    enum class UpdateMode {
+        Immediate,      ///< Apply at once and pump the event loop (legacy)
+        FrameCoalesced  ///< Store, then apply in one batch per frame
+    };
+
+    /**
+     * @brief How the splash content is built; fixed at construction
+     */
+    enum class RenderMode {
+        Widgets,    ///< Child widgets and layouts, styled by QSS
+        Flat        ///< No children: drawn by the splash itself; QSS colors only
+    };
+
+    /**
+     * @brief How the rounded window shape is produced
+     */
+    enum class WindowMode {
+        Auto,           ///< OpaqueMasked without a compositor, else Translucent
+        Translucent,    ///< Per-pixel alpha (needs compositing)
+        OpaqueMasked    ///< Opaque window clipped by a region mask
+    };
+
+    /**
+     * @brief Rendering effort chosen by the adaptive frame-rate governor
+     */
+    enum class RenderTier {
+        Full,       ///< Display-rate animation, gradients and shadows
+        Reduced,    ///< ~30 Hz animation
+        Minimal,    ///< ~10 Hz animation, flat colors, no shadows
+        Paused      ///< Window not exposed (minimized, hidden): no animation
+    };
+    Q_ENUM(RenderTier)
+
+    /**
+     * @brief Work triggered by configuration setters (see beginUpdate())
+     */
+    struct UpdateStats {
+        int rasterizations = 0;  ///< Logo raster requests (disk cache hits included)
+        int polishes = 0;        ///< Stylesheets applied; each re-polishes the tree
+        int layouts = 0;         ///< Layout passes of the splash
+    };
+
     explicit SplashScreenWidget(QWidget *parent = nullptr);
+    explicit SplashScreenWidget(RenderMode mode, QWidget *parent = nullptr);
     ~SplashScreenWidget() override;
 
+    /**
+     * @brief Collect configuration changes until the matching endUpdate().
+     * Sizes, logos and stylesheets set in between are applied in one
+     * pass: one polish, one rasterization per asset at its final size,
+     * one layout. Calls may nest.
+     */
+    void beginUpdate();
+    void endUpdate();
+    UpdateStats updateStats() const { return m_updateStats; }
+    void resetUpdateStats() { m_updateStats = UpdateStats(); }
+
+    /**
+     * @brief Memory held by the splash's rasters
+     */
+    struct MemoryFootprint {
+        qint64 pixmapBytes = 0;  ///< Background cache and label pixmaps
+        qint64 imageBytes = 0;   ///< Logo, baked shadows, pending snapshot
+        qint64 mappedBytes = 0;  ///< Asset bundle mapping (file-backed)
+        qint64 total() const { return pixmapBytes + imageBytes + mappedBytes; }
+    };
+    MemoryFootprint memoryFootprint() const;
+
+    /**
+     * @brief Free the child widgets, caches, stylesheet, asset bundle and
+     * native window. Only allowed once the splash is closed; afterwards
+     * the object can only be destroyed (configuration, status and
+     * progress calls are ignored).
+     */
+    void releaseResources();
+    bool isReleased() const { return m_released; }
+
+    /**
+     * @brief Call releaseResources() right after splashFinished() (default:
+     * off). For splashes that outlive startup, e.g. stack objects in main().
+     */
+    void setReleaseResourcesOnFinish(bool enabled);
+
     // Configuration setters
     void setLogoPath(const QString &svgPath);
     void setLogoSize(const QSize &size);
     void setMinimumDisplayDuration(int milliseconds);
+
+    /**
+     * @brief Keep the splash hidden for this long after startSplash()
+     * (default: 0). If finishSplash() comes first the splash never
+     * appears; the minimum display duration counts from when it does.
+     * An adopted snapshot only counts as shown once the delay has passed.
+     */
+    void setShowDelay(int milliseconds);
+
+    /**
+     * @brief How long the completed "Ready!" state stays on screen before
+     * splashFinished() (default: 200 ms; 0 closes on the next event).
+     */
+    void setClosingDelay(int milliseconds);
     void setStyleSheetPath(const QString &qssPath);
     void setBackgroundColor(const QColor &color);
     void setWindowSize(const QSize &size);
@@ -67,19 +191,152 @@ public:
     void setCompanyLogoPath(const QString &svgPath);
     void setCompanyLogoSize(const QSize &size);
 
+    /**
+     * @brief Asynchronous variants of setLogoPath(), setCompanyLogoPath()
+     * and setStyleSheetPath(). Files are read and rasterized on a worker
+     * thread; the splash shows placeholders until each asset is swapped
+     * in. assetsLoaded() is emitted when nothing is pending any more.
+     */
+    void setLogoPathAsync(const QString &svgPath);
+    void setCompanyLogoPathAsync(const QString &path);
+    void setStyleSheetPathAsync(const QString &qssPath);
+    int pendingAssetCount() const { return m_pendingAssets; }
+
+    /**
+     * @brief Take logos, their sizes and the stylesheet from a bundle
+     * generated by qt-splash-screen-bundler. The file is mapped once and
+     * logos are used in place; no SVG parsing, decoding or QSS pruning.
+     * @return false if the bundle is missing or invalid (nothing changes)
+     */
+    bool setAssetBundle(const QString &path);
+
+    /**
+     * @brief Take over a snapshot window loaded at startup. Call before
+     * startSplash(). The snapshot is presented when the show delay has
+     * passed (at once without one) and stands in while assets load; the
+     * live splash replaces it after its first frame. A snapshot composed
+     * from another configuration (size, DPR, texts, app version, theme or
+     * logo files) is dropped at startSplash(). Takes ownership; nullptr is
+     * ignored.
+     */
+    void adoptSnapshot(SplashSnapshotWindow *window);
+
+    /**
+     * @brief Where the composed splash is saved after a run that reached
+     * finishSplash() (default: SplashSnapshotWindow::defaultPath()).
+     * An empty path disables snapshots.
+     */
+    void setSnapshotPath(const QString &path);
+
+    /**
+     * @brief Strip stylesheet rules that cannot match the splash's widgets
+     * before applying them (default: on). Set before loading a stylesheet.
+     */
+    void setStyleSheetPruning(bool enabled);
+
+    /**
+     * @brief Directory for pruned stylesheets (default: app cache dir).
+     * An empty path prunes on every load without caching.
+     */
+    void setStyleSheetCacheDirectory(const QString &path);
+
+    /**
+     * @brief Directory for rasterized logos (default: app cache dir).
+     * An empty path disables the disk cache. Call before setting logos.
+     */
+    void setLogoCacheDirectory(const QString &path);
+
+    /**
+     * @brief Declare the named initialization steps.
+     * In determinate mode the bar then advances by expected time, taken
+     * from the timing history, instead of by step count.
+     */
+    void setSteps(const QStringList &names);
+    void setTimingHistoryPath(const QString &path);
+    void setShowRemainingTime(bool show);
+    void setUpdateMode(UpdateMode mode);
+    UpdateMode updateMode() const { return m_updateMode; }
+
+    /**
+     * @brief Select the window mode. Takes effect only before the window
+     * is first shown.
+     */
+    void setWindowMode(WindowMode mode);
+    WindowMode windowMode() const { return m_windowMode; }
+
+    /**
+     * @brief Whether the resolved window mode is OpaqueMasked
+     */
+    bool isOpaqueMasked() const { return m_opaqueMasked; }
+
+    /**
+     * @brief Enable the frame-rate governor (default: on). When disabled the
+     * splash stays at its initial tier but still pauses while hidden.
+     */
+    void setAdaptiveRendering(bool enabled);
+
+    /**
+     * @brief Frame cost (paint + flush) above which the governor steps down.
+     */
+    void setFrameBudget(int milliseconds);
+
     // Progress control
     void setProgress(int step);
+
+    /**
+     * @brief Report progress inside a step. Thread-safe and cheap: the value
+     * is stored atomically and applied on the next frame, so calls may be
+     * made at any frequency from any thread.
+     * @param step Number of completed steps
+     * @param fraction Completion of the current step (0.0 - 1.0)
+     */
+    void setProgress(int step, qreal fraction);
+
+    /**
+     * @brief Reporter for fractional progress inside a named step.
+     * Must be requested on the GUI thread after setSteps(); the returned
+     * handle may then be used from any thread.
+     */
+    SplashStepReporter stepReporter(const QString &name) const;
+
+    /**
+     * @brief Lock-free channel for progress and status updates from any
+     * thread. Drained once per frame; no events are posted by writers.
+     */
+    std::shared_ptr<SplashProgressChannel> progressChannel() const { return m_channel; }
     void incrementProgress();
     void setStatusMessage(const QString &message);
+    void beginStep(const QString &name);
+    void endStep(const QString &name);
 
     // Lifecycle control
     void startSplash();
     void finishSplash();
     bool isReadyToClose() const;
 
+    /**
+     * @brief Apply pending updates and paint one frame synchronously.
+     * For callers that block the GUI thread. Rate-limited to one frame per
+     * FRAME_INTERVAL_MS; afterwards pending events are processed for at
+     * most @p maxMilliseconds (user input is excluded).
+     */
+    void pumpFrame(int maxMilliseconds = 0);
+
     // Getters
     int progressPosition() const { return m_progressPosition; }
     void setProgressPosition(int pos);
+    int estimatedRemainingMs() const { return m_remainingMs; }
+
+    /**
+     * @brief Device pixels repainted during the last full second the
+     * splash was painting (window background and children).
+     */
+    qint64 repaintedPixelsPerSecond() const { return m_repaintedPixelsPerSecond; }
+
+    RenderMode renderMode() const { return m_renderMode; }
+    RenderTier renderTier() const { return m_renderTier; }
+    qreal averageFrameCostMs() const { return m_frameCostMs; }
+    bool isDurationWeighted() const;
 
 signals:
     /**
@@ -93,43 +350,171 @@ signals:
      */
     void progressChanged(int current, int total);
 
+    /**
+     * @brief Emitted when the remaining-time estimate changes by at least
+     * one second (duration-weighted mode only)
+     */
+    void remainingTimeChanged(int milliseconds);
+
+    /**
+     * @brief Emitted when the governor switches rendering tier
+     */
+    void renderTierChanged(SplashScreenWidget::RenderTier tier);
+
+    /**
+     * @brief Emitted when the last pending asynchronous asset is applied
+     */
+    void assetsLoaded();
+
 protected:
+    bool event(QEvent *event) override;
+    bool eventFilter(QObject *watched, QEvent *event) override;
     void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
 
 private slots:
     void onMinimumDurationElapsed();
-    void updateBouncingProgress();
+    void onShowDelayElapsed();
+    void onFrameTick();
 
 private:
     void setupUi();
+    void setupChildWidgets();
+    void applyWindowMode();
     void applyRoundedMask();
+    void invalidateBackgroundCache();
+    void rebuildBackgroundCache(qreal devicePixelRatio);
+    void updateBakedShadows(qreal devicePixelRatio);
+    QPoint logoAnchor() const;
+    QPoint companyLogoAnchor() const;
     void loadStyleSheet(const QString &path);
-    void startBouncingAnimation();
-    void stopBouncingAnimation();
+    void applyStyleSheet(const QString &styleSheet);
+    void startIndeterminateAnimation();
+    void stopIndeterminateAnimation();
+    void accountRepaint(const QRegion &region);
+    void recordFrameCost(qint64 nsecs);
+    void setPerformanceTier(RenderTier tier);
+    void applyRenderTier();
+    void updateExposure();
+    int frameTimerInterval() const;
     void checkAndClose();
+    void showWindow();
+    void showWindowIfReady();
+    void markShown();
+    void scheduleSnapshotHandOff();
+    void handOffSnapshot();
+    void captureSnapshot();
+    QString snapshotKey() const;
+    void updateLogoImage(qreal devicePixelRatio);
+    void applyLogoImage(const QImage &image);
     void updateCompanyLogoPixmap();
+    static QImage loadCompanyLogoImage(const SplashLogoCache &cache, const QString &path,
+                                       const QSize &size, qreal devicePixelRatio);
+    static QString readStyleSheet(const QString &path);
+    void beginAssetLoad();
+    void endAssetLoad();
+    void showCompanyLogo(const QPixmap &pixmap);
+    void setBarMaximum(int maximum);
+    void setBarValue(int value);
+    void updateStatusLabel();
+    void updateWeightedProgress();
+    void applyPendingSubStepProgress();
+    void drainProgressChannel();
+    void startFrameTimer();
+    void recordStepTimings();
+    int progressMaximum() const;
 
     // UI Components
     QVBoxLayout *m_mainLayout;
-    QSvgWidget *m_logoWidget;
+    QLabel *m_logoWidget;
     QLabel *m_appNameLabel;
     QLabel *m_appVersionLabel;
     QLabel *m_companyNameLabel;
     QLabel *m_companyLogoLabel;
     QProgressBar *m_progressBar;
+    SplashProgressIndicator *m_progressIndicator;
     QLabel *m_statusLabel;
     QWidget *m_progressContainer;
     QWidget *m_companyContainer;
 
+    // Flat render mode (replaces all of the above)
+    RenderMode m_renderMode;
+    std::unique_ptr<SplashFlatRenderer> m_flatRenderer;
+    QElapsedTimer m_flatAnimationClock;
+    bool m_flatAnimating;
+
     // Animation
-    QTimer *m_bounceTimer;
     int m_progressPosition;
-    int m_bounceDirection;
-    static constexpr int BOUNCE_STEP = 2;
-    static constexpr int BOUNCE_INTERVAL_MS = 15;
+    static constexpr int FRAME_INTERVAL_MS = 16;
+
+    // Repaint accounting
+    QElapsedTimer m_repaintWindow;
+    qint64 m_repaintedPixels;
+    qint64 m_repaintedPixelsPerSecond;
+
+    // Window shape
+    WindowMode m_windowMode;
+    bool m_opaqueMasked;
+    QRegion m_maskRegion;
+    QSize m_maskSize;
+    int m_maskRadius;
+
+    // Adaptive frame-rate governor
+    RenderTier m_performanceTier;  ///< Tier chosen from frame cost
+    RenderTier m_renderTier;       ///< Effective tier (Paused while hidden)
+    bool m_adaptiveRendering;
+    bool m_exposed;
+    bool m_windowHooked;
+    bool m_flatChrome;
+    qreal m_frameBudgetMs;
+    qreal m_frameCostMs;
+    int m_slowFrameStreak;
+    int m_upgradeDelayMs;
+    QElapsedTimer m_tierClock;
+    static constexpr int SLOW_FRAME_LIMIT = 10;
+    static constexpr int DEFAULT_FRAME_BUDGET_MS = 8;
+    static constexpr int TIER_UPGRADE_DELAY_MS = 3000;
+    static constexpr int MAX_TIER_UPGRADE_DELAY_MS = 30000;
+    static constexpr int REDUCED_FRAME_INTERVAL_MS = 33;
+    static constexpr int MINIMAL_FRAME_INTERVAL_MS = 100;
+    static constexpr int PAUSED_FRAME_INTERVAL_MS = 250;
+
+    // Duration-weighted progress
+    struct StepTiming {
+        QString name;
+        qint64 expectedMs;
+        qint64 startedAtMs;   ///< -1 until beginStep()
+        qint64 finishedAtMs;  ///< -1 until endStep()
+        std::shared_ptr<std::atomic<int>> reportedFraction;  ///< -1 until reported
+    };
+    QTimer *m_frameTimer;
+    QVector<StepTiming> m_steps;
+    QHash<QString, int> m_stepIndex;
+    SplashTimingHistory m_timingHistory;
+    bool m_timingHistoryLoaded;
+    QElapsedTimer m_stepClock;
+    double m_weightedFraction;
+    int m_remainingMs;
+    bool m_showRemainingTime;
+    QString m_statusMessage;
+    static constexpr int WEIGHTED_RESOLUTION = 1000;
+    static constexpr int SUB_STEP_RESOLUTION = SplashProgressChannel::FRACTION_RESOLUTION;
+
+    // Cross-thread updates, drained once per frame
+    std::shared_ptr<SplashProgressChannel> m_channel;
+    int m_appliedSubStepValue;
+
+    // Frame-coalesced updates
+    UpdateMode m_updateMode;
+    bool m_statusDirty;
+    QElapsedTimer m_lastPumpTimer;
+    static constexpr qint64 DEFAULT_STEP_DURATION_MS = 500;
 
     // Configuration
     int m_minimumDisplayDuration;
+    int m_showDelay;
+    int m_closingDelay;
+    static constexpr int DEFAULT_CLOSING_DELAY_MS = 200;
     int m_totalSteps;
     int m_currentStep;
     ProgressMode m_progressMode;
@@ -142,11 +527,77 @@ private:
     QColor m_borderColor;
     QColor m_backgroundColor;
 
+    // Static window chrome (shadow, gradients, border) rendered once;
+    // rebuilt only when size, radius, colors, border or DPR change
+    QPixmap m_backgroundCache;
+
+    // Logo drop shadows, baked once per logo/size/DPR and composited into
+    // the background cache at the logo positions
+    struct BakedShadow {
+        SplashShadowRenderer::Shadow shadow;
+        QString key;
+        QPoint anchor;  ///< Logical top-left of the shadowed image
+    };
+    BakedShadow m_logoShadow;
+    BakedShadow m_companyLogoShadow;
+    QString m_logoPath;
+
+    // Logos as plain rasters; SVGs are rendered once per size/DPR and
+    // reused across launches through the disk cache
+    QImage m_logoImage;
+    SplashLogoCache m_logoCache;
+
+    // Memory-mapped assets; logo images may be views into the mapping
+    std::unique_ptr<SplashAssetBundle> m_assetBundle;
+    bool m_logoFromBundle;
+
+    // Stylesheets reduced to the rules this widget tree can match
+    SplashStyleSheetCache m_styleSheetCache;
+    bool m_pruneStyleSheets;
+    QString m_styleSheetPath;  ///< Last theme file requested (part of the snapshot key)
+
+    // Asynchronous asset loading; a generation bump discards stale results
+    int m_pendingAssets;
+    int m_logoGeneration;
+    int m_companyLogoGeneration;
+    int m_styleGeneration;
+    bool m_logoPending;
+    bool m_companyLogoPending;
+
+    static constexpr qreal LOGO_SHADOW_BLUR = 18.0;
+    static constexpr int LOGO_SHADOW_OFFSET_Y = 6;
+    static constexpr int LOGO_SHADOW_ALPHA = 55;
+    static constexpr qreal COMPANY_SHADOW_BLUR = 12.0;
+    static constexpr int COMPANY_SHADOW_OFFSET_Y = 4;
+    static constexpr int COMPANY_SHADOW_ALPHA = 45;
+
+    // Startup snapshot: loaded before this widget exists and presented in
+    // its place while assets load; captured once the splash is fully composed
+    std::unique_ptr<SplashSnapshotWindow> m_snapshotWindow;
+    QString m_snapshotPath;
+    QImage m_snapshotImage;
+    bool m_waitingForAssets;     ///< Live window hidden until async assets arrive (snapshot swap)
+    bool m_waitingForShowDelay;  ///< Hidden until the show delay has passed
+
+    // Batched configuration: setters record, endUpdate() applies
+    int m_updateDepth;
+    bool m_geometryDirty;
+    bool m_logoDirty;
+    bool m_companyLogoDirty;
+    QString m_deferredStyleSheetPath;
+    bool m_deferredStyleSheetAsync;
+    QString m_deferredStyleSheet;  ///< From a bundle; applied if no path came later
+    UpdateStats m_updateStats;
+
     // State tracking
     QElapsedTimer m_elapsedTimer;
     bool m_minimumDurationElapsed;
     bool m_finishRequested;
+    qint64 m_finishRequestedMs;  ///< Startup duration: startSplash() to finishSplash()
     bool m_isClosed;
+    bool m_shown;  ///< Live window or adopted snapshot has been on screen
+    bool m_releaseOnFinish;
+    bool m_released;
 };
 
 #endif // SPLASHSCREENWIDGET_H
@@ -0,0 +1,138 @@
+#include "SplashShadowRenderer.h"
+#include <QtMath>
+#include <vector>
+#include <cstdint>
+
+SplashShadowRenderer::Shadow SplashShadowRenderer::renderShadow(const QImage &source,
+                                                                qreal blurRadius,
+                                                                const QColor &color)
+{
+    Shadow shadow;
+    if (source.isNull()) {
+        return shadow;
+    }
+
+    // Three box passes of width w approximate a Gaussian with
+    // sigma^2 = (w^2 - 1) / 4; QGraphicsDropShadowEffect uses sigma ~ radius / 2.
+    const qreal dpr = source.devicePixelRatio();
+    const qreal sigma = blurRadius * dpr / 2.0;
+    const int boxRadius = qMax(1, qRound((qSqrt(4.0 * sigma * sigma + 1.0) - 1.0) / 2.0));
+    const int padding = 3 * boxRadius;
+
+    const QImage src = source.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    const int width = src.width() + 2 * padding;
+    const int height = src.height() + 2 * padding;
+
+    std::vector<uchar> alpha(static_cast<size_t>(width) * height, 0);
+    for (int y = 0; y < src.height(); ++y) {
+        const QRgb *line = reinterpret_cast<const QRgb *>(src.constScanLine(y));
+        uchar *dst = alpha.data() + static_cast<size_t>(y + padding) * width + padding;
+        for (int x = 0; x < src.width(); ++x) {
+            dst[x] = static_cast<uchar>(qAlpha(line[x]));
+        }
+    }
+
+    blurAlpha(alpha.data(), width, height, boxRadius);
+
+    // Tint: premultiplied color scaled by the blurred coverage
+    const uint colorAlpha = static_cast<uint>(color.alpha());
+    const uint red = static_cast<uint>(color.red());
+    const uint green = static_cast<uint>(color.green());
+    const uint blue = static_cast<uint>(color.blue());
+
+    shadow.image = QImage(width, height, QImage::Format_ARGB32_Premultiplied);
+    for (int y = 0; y < height; ++y) {
+        const uchar *a = alpha.data() + static_cast<size_t>(y) * width;
+        QRgb *line = reinterpret_cast<QRgb *>(shadow.image.scanLine(y));
+        for (int x = 0; x < width; ++x) {
+            const uint coverage = (a[x] * colorAlpha + 127) / 255;
+            line[x] = qRgba((red * coverage + 127) / 255,
+                            (green * coverage + 127) / 255,
+                            (blue * coverage + 127) / 255,
+                            coverage);
+        }
+    }
+    shadow.image.setDevicePixelRatio(dpr);
+    shadow.padding = padding;
+    return shadow;
+}
+
+void SplashShadowRenderer::blurAlpha(uchar *alpha, int width, int height, int boxRadius)
+{
+    if (width <= 0 || height <= 0 || boxRadius <= 0) {
+        return;
+    }
+
+    std::vector<uchar> scratch(static_cast<size_t>(width) * height);
+
+    // Vertical blur: three passes, result back in alpha
+    boxBlurColumns(alpha, scratch.data(), width, height, boxRadius);
+    boxBlurColumns(scratch.data(), alpha, width, height, boxRadius);
+    boxBlurColumns(alpha, scratch.data(), width, height, boxRadius);
+
+    // Horizontal blur as a vertical blur of the transposed image
+    transpose(scratch.data(), alpha, width, height);
+    boxBlurColumns(alpha, scratch.data(), height, width, boxRadius);
+    boxBlurColumns(scratch.data(), alpha, height, width, boxRadius);
+    boxBlurColumns(alpha, scratch.data(), height, width, boxRadius);
+    transpose(scratch.data(), alpha, height, width);
+}
+
+void SplashShadowRenderer::boxBlurColumns(const uchar *src, uchar *dst,
+                                          int width, int height, int radius)
+{
+    // Running column sums; every inner loop walks a contiguous row, so it
+    // maps directly onto SIMD lanes.
+    const uint32_t window = static_cast<uint32_t>(2 * radius + 1);
+    const uint32_t scale = ((1u << 16) + window / 2) / window;
+    std::vector<uint32_t> acc(static_cast<size_t>(width), 0);
+    uint32_t *sum = acc.data();
+
+    for (int row = 0; row <= radius && row < height; ++row) {
+        const uchar *in = src + static_cast<size_t>(row) * width;
+        for (int x = 0; x < width; ++x) {
+            sum[x] += in[x];
+        }
+    }
+
+    for (int y = 0; y < height; ++y) {
+        uchar *out = dst + static_cast<size_t>(y) * width;
+        for (int x = 0; x < width; ++x) {
+            out[x] = static_cast<uchar>((sum[x] * scale + (1u << 15)) >> 16);
+        }
+
+        const int addRow = y + radius + 1;
+        if (addRow < height) {
+            const uchar *in = src + static_cast<size_t>(addRow) * width;
+            for (int x = 0; x < width; ++x) {
+                sum[x] += in[x];
+            }
+        }
+
+        const int subRow = y - radius;
+        if (subRow >= 0) {
+            const uchar *in = src + static_cast<size_t>(subRow) * width;
+            for (int x = 0; x < width; ++x) {
+                sum[x] -= in[x];
+            }
+        }
+    }
+}
+
+void SplashShadowRenderer::transpose(const uchar *src, uchar *dst, int width, int height)
+{
+    // Blocked to keep both source rows and destination rows in cache
+    const int BLOCK = 32;
+    for (int by = 0; by < height; by += BLOCK) {
+        const int yEnd = qMin(by + BLOCK, height);
+        for (int bx = 0; bx < width; bx += BLOCK) {
+            const int xEnd = qMin(bx + BLOCK, width);
+            for (int y = by; y < yEnd; ++y) {
+                const uchar *in = src + static_cast<size_t>(y) * width;
+                for (int x = bx; x < xEnd; ++x) {
+                    dst[static_cast<size_t>(x) * height + y] = in[x];
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef SPLASHSHADOWRENDERER_H
+#define SPLASHSHADOWRENDERER_H
+
+#include <QImage>
+#include <QColor>
+
+/**
+ * @brief Bakes soft drop shadows into plain images.
+ *
+ * Replaces QGraphicsDropShadowEffect, which renders its source offscreen
+ * and blurs it again on every repaint. The shadow is computed once from
+ * the source alpha channel with three passes of a separable box blur
+ * (a close Gaussian approximation). Both directions run as column passes
+ * over contiguous rows, so the inner loops are straight-line arithmetic
+ * on byte and integer arrays that the compiler vectorizes.
+ */
+class SplashShadowRenderer
+{
+public:
+    /**
+     * @brief Shadow image plus the margin it extends past the source
+     */
+    struct Shadow {
+        QImage image;     ///< Premultiplied ARGB, same DPR as the source
+        int padding = 0;  ///< Margin on every side, in device pixels
+    };
+
+    /**
+     * @brief Render the blurred, tinted silhouette of @p source.
+     * @param source Image whose alpha channel defines the shadow shape
+     * @param blurRadius Blur radius in logical pixels (QGraphicsDropShadowEffect scale)
+     * @param color Shadow color; its alpha scales the shadow opacity
+     */
+    static Shadow renderShadow(const QImage &source, qreal blurRadius, const QColor &color);
+
+    /**
+     * @brief In-place three-pass box blur of an 8-bit alpha buffer.
+     * @param alpha Buffer of width * height bytes, tightly packed
+     */
+    static void blurAlpha(uchar *alpha, int width, int height, int boxRadius);
+
+private:
+    static void boxBlurColumns(const uchar *src, uchar *dst, int width, int height, int radius);
+    static void transpose(const uchar *src, uchar *dst, int width, int height);
+};
+
+#endif // SPLASHSHADOWRENDERER_H
@@ -0,0 +1,141 @@
+#include "SplashSnapshotWindow.h"
+#include <QGuiApplication>
+#include <QScreen>
+#include <QPainter>
+#include <QBitmap>
+#include <QRegion>
+#include <QElapsedTimer>
+#include <QStandardPaths>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QFileInfo>
+#include <QDir>
+#include <QDebug>
+
+namespace {
+const QString SNAPSHOT_ENTRY = QStringLiteral("snapshot");
+constexpr int SNAPSHOT_FORMAT_VERSION = 2;
+constexpr int EXPOSE_WAIT_MS = 100;
+}
+
+SplashSnapshotWindow::SplashSnapshotWindow(std::unique_ptr<SplashAssetBundle> bundle,
+                                           const QImage &image, bool opaqueMasked,
+                                           const QString &key)
+    : m_bundle(std::move(bundle))
+    , m_image(image)
+    , m_key(key)
+{
+    setFlags(Qt::FramelessWindowHint | Qt::WindowStaysOnTopHint | Qt::SplashScreen);
+    resize(snapshotSize());
+
+    if (opaqueMasked) {
+        // Same shape as the live window: transparent pixels are outside
+        const QImage alphaMask = m_image.createAlphaMask().scaled(snapshotSize());
+        setMask(QRegion(QBitmap::fromImage(alphaMask)));
+    } else {
+        QSurfaceFormat surfaceFormat = format();
+        surfaceFormat.setAlphaBufferSize(8);
+        setFormat(surfaceFormat);
+    }
+}
+
+SplashSnapshotWindow::~SplashSnapshotWindow() = default;
+
+QString SplashSnapshotWindow::defaultPath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/splash_snapshot.bundle";
+}
+
+SplashSnapshotWindow *SplashSnapshotWindow::loadSnapshot(const QString &path, int showDelayMs)
+{
+    auto bundle = std::make_unique<SplashAssetBundle>();
+    if (!bundle->open(path)) {
+        return nullptr;
+    }
+
+    const QScreen *screen = QGuiApplication::primaryScreen();
+    const qreal dpr = screen ? screen->devicePixelRatio() : 1.0;
+    const QImage image = bundle->image(SNAPSHOT_ENTRY, dpr);
+    if (image.isNull() || !qFuzzyCompare(image.devicePixelRatio(), dpr)) {
+        return nullptr;
+    }
+    const QJsonObject metadata = bundle->metadata();
+    if (metadata.value("formatVersion").toInt() != SNAPSHOT_FORMAT_VERSION) {
+        return nullptr;
+    }
+    const qint64 startupMs = metadata.value("startupMs").toInteger(-1);
+    if (startupMs >= 0 && startupMs < showDelayMs) {
+        return nullptr;
+    }
+    const bool opaqueMasked = metadata.value("opaqueMasked").toBool();
+
+    const QString key = metadata.value("key").toString();
+
+    auto *window = new SplashSnapshotWindow(std::move(bundle), image, opaqueMasked, key);
+    if (screen) {
+        const QRect available = screen->availableGeometry();
+        const QSize size = window->snapshotSize();
+        window->setPosition(available.x() + (available.width() - size.width()) / 2,
+                            available.y() + (available.height() - size.height()) / 2);
+    }
+
+    // Native window now, so present() is only a map and a blit
+    window->create();
+    return window;
+}
+
+void SplashSnapshotWindow::present()
+{
+    if (isVisible()) {
+        return;
+    }
+    QElapsedTimer clock;
+    clock.start();
+    show();
+
+    // The first paint happens on expose; deliver it now rather than when
+    // the caller next spins the event loop
+    while (!isExposed() && clock.elapsed() < EXPOSE_WAIT_MS) {
+        QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
+    }
+}
+
+bool SplashSnapshotWindow::save(const QString &path, const QImage &image, bool opaqueMasked,
+                                qint64 startupMs, const QString &key)
+{
+    if (image.isNull() || path.isEmpty()) {
+        return false;
+    }
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    SplashAssetBundle::Entry snapshot;
+    snapshot.name = SNAPSHOT_ENTRY;
+    snapshot.image = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+
+    SplashAssetBundle::Entry metadata;
+    metadata.name = QStringLiteral("metadata");
+    QJsonObject values;
+    values.insert("formatVersion", SNAPSHOT_FORMAT_VERSION);
+    values.insert("opaqueMasked", opaqueMasked);
+    values.insert("startupMs", startupMs);
+    values.insert("key", key);
+    metadata.data = QJsonDocument(values).toJson(QJsonDocument::Compact);
+
+    const bool saved = SplashAssetBundle::write(path, {snapshot, metadata});
+    if (!saved) {
+        qWarning() << "SplashScreen: Could not write snapshot:" << path;
+    }
+    return saved;
+}
+
+QSize SplashSnapshotWindow::snapshotSize() const
+{
+    return (QSizeF(m_image.size()) / m_image.devicePixelRatio()).toSize();
+}
+
+void SplashSnapshotWindow::paintEvent(QPaintEvent * /* event */)
+{
+    QPainter painter(this);
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+    painter.drawImage(QPoint(0, 0), m_image);
+}
@@ -0,0 +1,101 @@
+#ifndef SPLASHSNAPSHOTWINDOW_H
+#define SPLASHSNAPSHOTWINDOW_H
+
+#include <QRasterWindow>
+#include <QImage>
+#include <QString>
+#include <memory>
+
+#include "SplashAssetBundle.h"
+
+/**
+ * @brief Minimal raw window showing the splash as it looked last run.
+ *
+ * A QRasterWindow: no widgets, no style, no layout. Loading maps the
+ * snapshot file and creates the native window; present() then only has to
+ * map it and blit one image. The adopting SplashScreenWidget presents it
+ * when its show delay has passed and replaces it once fully composed
+ * (see SplashScreenWidget::adoptSnapshot()).
+ *
+ * Snapshots are single-image SplashAssetBundle files, so loading is a
+ * memory map with no decoding. A snapshot taken at another device pixel
+ * ratio or by another format version is ignored rather than scaled. Each
+ * one also carries a key of the configuration that produced it; the
+ * adopting splash drops a snapshot whose key or size no longer matches.
+ *
+ * @code
+ * QApplication app(argc, argv);
+ * app.setOrganizationName(...);  // before: part of defaultPath()
+ * app.setApplicationName(...);
+ * SplashSnapshotWindow *snapshot = SplashSnapshotWindow::loadSnapshot();
+ * SplashScreenWidget splash;
+ * ...
+ * splash.adoptSnapshot(snapshot);
+ * splash.startSplash();
+ * @endcode
+ */
+class SplashSnapshotWindow : public QRasterWindow
+{
+    Q_OBJECT
+
+public:
+    ~SplashSnapshotWindow() override;
+
+    /**
+     * @brief Snapshot file in the app cache directory.
+     *
+     * The cache directory includes the organization and application names:
+     * set them before calling this (and before constructing the
+     * SplashScreenWidget), or reading and saving use different paths.
+     */
+    static QString defaultPath();
+
+    /**
+     * @brief Map the snapshot stored at @p path and create its window,
+     * centered on the primary screen, without showing it.
+     * @param showDelayMs Skip the snapshot if the run that saved it
+     * finished faster than this (see SplashScreenWidget::setShowDelay())
+     * @return The window (owned by the caller), or nullptr if there is no
+     * usable snapshot
+     */
+    static SplashSnapshotWindow *loadSnapshot(const QString &path = defaultPath(),
+                                              int showDelayMs = 0);
+
+    /**
+     * @brief Show the window and deliver its first paint at once.
+     */
+    void present();
+
+    /**
+     * @brief Store @p image (premultiplied ARGB with its DPR). Pixels with
+     * zero alpha are masked out when the window is opaque.
+     * @param startupMs Startup time of the run that produced it, from
+     * startSplash() to finishSplash() (-1: unknown)
+     * @param key Configuration the image was composed from (see key())
+     */
+    static bool save(const QString &path, const QImage &image, bool opaqueMasked,
+                     qint64 startupMs = -1, const QString &key = QString());
+
+    /**
+     * @brief Logical size of the snapshot
+     */
+    QSize snapshotSize() const;
+
+    /**
+     * @brief Configuration key stored with the snapshot (empty if none)
+     */
+    QString key() const { return m_key; }
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
+private:
+    SplashSnapshotWindow(std::unique_ptr<SplashAssetBundle> bundle, const QImage &image,
+                         bool opaqueMasked, const QString &key);
+
+    std::unique_ptr<SplashAssetBundle> m_bundle;
+    QImage m_image;  ///< View into m_bundle
+    QString m_key;
+};
+
+#endif // SPLASHSNAPSHOTWINDOW_H
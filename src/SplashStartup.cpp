@@ -0,0 +1,218 @@
+#include "SplashStartup.h"
+#include "SplashScreenWidget.h"
+#include <QApplication>
+#include <QLayout>
+#include <QWindow>
+#include <QImage>
+#include <QTimer>
+#include <QDebug>
+
+SplashStartup::SplashStartup(SplashScreenWidget *splash, QObject *parent)
+    : QObject(parent)
+    , m_splash(splash)
+    , m_nextSlice(0)
+    , m_sliceBudgetMs(DEFAULT_SLICE_BUDGET_MS)
+    , m_constructionNs(0)
+    , m_phase(Phase::Idle)
+    , m_ready(false)
+    , m_finishRequested(false)
+    , m_handoffLatencyUs(-1)
+{
+    if (m_splash) {
+        connect(m_splash, &SplashScreenWidget::splashFinished, this, &SplashStartup::handOff);
+    }
+}
+
+SplashStartup::~SplashStartup()
+{
+    delete m_mainWindow.data();
+}
+
+void SplashStartup::setMainWindowFactory(Factory factory)
+{
+    m_factory = std::move(factory);
+}
+
+void SplashStartup::addSlice(const QString &name, Slice slice)
+{
+    if (m_ready) {
+        qWarning() << "SplashStartup: slice added after the main window was ready:" << name;
+        return;
+    }
+    m_slices.append({name, std::move(slice)});
+}
+
+void SplashStartup::setSliceBudget(int milliseconds)
+{
+    m_sliceBudgetMs = qMax(1, milliseconds);
+}
+
+void SplashStartup::start()
+{
+    if (m_phase != Phase::Idle) {
+        return;
+    }
+    m_phase = Phase::Construction;
+
+    if (m_splash) {
+        m_splash->startSplash();
+    }
+    QTimer::singleShot(0, this, &SplashStartup::createMainWindow);
+}
+
+void SplashStartup::finish()
+{
+    if (m_finishRequested) {
+        return;
+    }
+    m_finishRequested = true;
+
+    // Still constructing: pre-warm right after the last slice
+    if (m_phase == Phase::Construction) {
+        return;
+    }
+    queuePrewarmSlices();
+    runSlices();
+}
+
+void SplashStartup::createMainWindow()
+{
+    // Put the first splash frame on screen before any construction work
+    if (m_splash) {
+        m_splash->pumpFrame();
+    }
+
+    if (m_factory) {
+        QElapsedTimer clock;
+        clock.start();
+        m_mainWindow = m_factory();
+        m_constructionNs += clock.nsecsElapsed();
+        emit mainWindowCreated(m_mainWindow);
+    }
+    runSlices();
+}
+
+void SplashStartup::runSlices()
+{
+    QElapsedTimer budget;
+    budget.start();
+    while (m_nextSlice < m_slices.size() && budget.elapsed() < m_sliceBudgetMs) {
+        // Copy: a slice may queue further slices
+        const NamedSlice slice = m_slices.at(m_nextSlice++);
+        QElapsedTimer clock;
+        clock.start();
+        slice.run();
+        m_constructionNs += clock.nsecsElapsed();
+    }
+
+    if (m_nextSlice < m_slices.size()) {
+        // Let the splash present a frame, then continue on the next turn
+        if (m_splash) {
+            m_splash->pumpFrame();
+        }
+        QTimer::singleShot(0, this, &SplashStartup::runSlices);
+        return;
+    }
+
+    m_slices.clear();
+    m_nextSlice = 0;
+    onSlicesDone();
+}
+
+void SplashStartup::onSlicesDone()
+{
+    if (m_phase == Phase::Construction) {
+        m_ready = true;
+        m_phase = Phase::Idle;
+        emit mainWindowReady(m_mainWindow);
+
+        if (m_finishRequested && m_phase == Phase::Idle) {
+            queuePrewarmSlices();
+            runSlices();
+        }
+    } else if (m_phase == Phase::Prewarm) {
+        m_phase = Phase::Finished;
+        if (m_splash) {
+            m_splash->finishSplash();
+        } else {
+            handOff();
+        }
+    }
+}
+
+void SplashStartup::queuePrewarmSlices()
+{
+    m_phase = Phase::Prewarm;
+
+    // Everything show() would otherwise do on the first frame after the
+    // splash closes, done while the splash is still up
+    m_slices.append({"polish", [this]() {
+        if (!m_mainWindow) {
+            return;
+        }
+        m_mainWindow->ensurePolished();
+        const QList<QWidget *> children = m_mainWindow->findChildren<QWidget *>();
+        for (QWidget *child : children) {
+            child->ensurePolished();
+        }
+    }});
+    m_slices.append({"layout", [this]() {
+        if (!m_mainWindow) {
+            return;
+        }
+        if (!m_mainWindow->testAttribute(Qt::WA_Resized)) {
+            m_mainWindow->resize(m_mainWindow->sizeHint().expandedTo(m_mainWindow->minimumSize()));
+        }
+        QApplication::sendPostedEvents(nullptr, QEvent::LayoutRequest);
+        if (QLayout *layout = m_mainWindow->layout()) {
+            layout->activate();
+        }
+    }});
+    m_slices.append({"window", [this]() {
+        if (m_mainWindow) {
+            m_mainWindow->winId();  // Native window without showing it
+        }
+    }});
+    m_slices.append({"warm render", [this]() {
+        if (!m_mainWindow) {
+            return;
+        }
+        // Paints every visible widget once into a throwaway image to fill
+        // style, font and glyph caches. show() still repaints the tree into
+        // the real backing store; this only makes that paint cheaper.
+        const qreal dpr = m_mainWindow->devicePixelRatioF();
+        QImage frame(m_mainWindow->size() * dpr, QImage::Format_ARGB32_Premultiplied);
+        frame.setDevicePixelRatio(dpr);
+        m_mainWindow->render(&frame);
+    }});
+}
+
+void SplashStartup::handOff()
+{
+    if (!m_mainWindow || m_mainWindow->isVisible()) {
+        return;
+    }
+
+    m_handoffClock.start();
+    m_mainWindow->show();
+    if (QWindow *window = m_mainWindow->windowHandle()) {
+        window->installEventFilter(this);
+    }
+    m_mainWindow->raise();
+    m_mainWindow->activateWindow();
+}
+
+bool SplashStartup::eventFilter(QObject *watched, QEvent *event)
+{
+    QWindow *window = m_mainWindow ? m_mainWindow->windowHandle() : nullptr;
+    if (watched == window && event->type() == QEvent::Expose && window->isExposed()) {
+        window->removeEventFilter(this);
+
+        // Queued: stamp after the exposed frame has been painted and flushed
+        QTimer::singleShot(0, this, [this]() {
+            m_handoffLatencyUs = m_handoffClock.nsecsElapsed() / 1000;
+            emit handoffCompleted(m_handoffLatencyUs);
+        });
+    }
+    return QObject::eventFilter(watched, event);
+}
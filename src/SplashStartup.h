@@ -0,0 +1,158 @@
+#ifndef SPLASHSTARTUP_H
+#define SPLASHSTARTUP_H
+
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QVector>
+#include <QWidget>
+#include <QElapsedTimer>
+#include <functional>
+#include <memory>
+
+class SplashScreenWidget;
+
+/**
+ * @brief Splash-first application startup.
+ *
+ * Shows the splash before anything else, then creates the main window
+ * through a factory and runs its construction in slices between splash
+ * frames. Slices run back to back while they fit the slice budget; then
+ * the splash gets a frame and the rest continues on the next event loop
+ * turn. Construction cost therefore overlaps the splash animation
+ * instead of delaying the first splash frame.
+ *
+ * When initialization is done, finish() polishes, lays out and renders
+ * the main window offscreen (again in slices) before closing the splash.
+ * On splashFinished() the main window is shown. show() still repaints the
+ * whole widget tree into the window's backing store, but with styles,
+ * layouts, fonts and glyphs already cached that paint is cheap. The time
+ * until the window is on screen is reported as the handoff latency.
+ *
+ * @code
+ * SplashStartup startup(&splash);
+ * startup.setMainWindowFactory([&startup]() {
+ *     auto *window = new MainWindow(MainWindow::UiConstruction::Deferred);
+ *     window->addConstructionSlices(startup);
+ *     return window;
+ * });
+ * connect(&startup, &SplashStartup::mainWindowReady, ...);
+ * connect(window, &MainWindow::initializationComplete, &startup, &SplashStartup::finish);
+ * startup.start();
+ * @endcode
+ *
+ * A single slice is never interrupted: split work that takes longer than
+ * a frame into several slices.
+ */
+class SplashStartup : public QObject
+{
+    Q_OBJECT
+
+public:
+    using Factory = std::function<QWidget *()>;
+    using Slice = std::function<void()>;
+
+    explicit SplashStartup(SplashScreenWidget *splash, QObject *parent = nullptr);
+    ~SplashStartup() override;
+
+    /**
+     * @brief Create the main window. Runs on the first event loop turn
+     * after the splash is shown; keep the constructor cheap and register
+     * the heavy parts with addSlice(). The window is owned by this object.
+     */
+    void setMainWindowFactory(Factory factory);
+
+    /**
+     * @brief Queue a construction step. May be called from the factory or
+     * from a mainWindowCreated() handler; slices run in order.
+     */
+    void addSlice(const QString &name, Slice slice);
+
+    /**
+     * @brief Work per event loop turn before the splash gets a frame
+     * (default: 10 ms).
+     */
+    void setSliceBudget(int milliseconds);
+
+    /**
+     * @brief Show the splash and begin constructing the main window.
+     */
+    void start();
+
+    /**
+     * @brief Pre-warm the main window offscreen (polish, layout, native
+     * window, one throwaway render to fill the caches), then call
+     * finishSplash(). Use in place of
+     * finishSplash() once initialization is complete.
+     */
+    void finish();
+
+    QWidget *mainWindow() const { return m_mainWindow.data(); }
+    bool isReady() const { return m_ready; }
+
+    /**
+     * @brief From splashFinished() to the main window's first exposed
+     * frame; -1 until the handoff happened
+     */
+    qint64 handoffLatencyUs() const { return m_handoffLatencyUs; }
+
+    /**
+     * @brief Time spent in the factory and slices (excludes splash frames)
+     */
+    qint64 constructionTimeMs() const { return m_constructionNs / 1000000; }
+
+signals:
+    /**
+     * @brief Emitted right after the factory returned; slices not yet run
+     */
+    void mainWindowCreated(QWidget *window);
+
+    /**
+     * @brief Emitted after the last slice has run
+     */
+    void mainWindowReady(QWidget *window);
+
+    /**
+     * @brief Emitted when the main window is on screen after the splash
+     */
+    void handoffCompleted(qint64 latencyUs);
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private:
+    struct NamedSlice {
+        QString name;
+        Slice run;
+    };
+
+    enum class Phase {
+        Idle,
+        Construction,  ///< Factory and addSlice() slices
+        Prewarm,       ///< Offscreen polish, layout and cache-warming render
+        Finished       ///< finishSplash() called
+    };
+
+    void createMainWindow();
+    void runSlices();
+    void onSlicesDone();
+    void queuePrewarmSlices();
+    void handOff();
+
+    QPointer<SplashScreenWidget> m_splash;
+    Factory m_factory;
+    QVector<NamedSlice> m_slices;
+    int m_nextSlice;
+    int m_sliceBudgetMs;
+    QPointer<QWidget> m_mainWindow;
+    qint64 m_constructionNs;
+    Phase m_phase;
+    bool m_ready;
+    bool m_finishRequested;
+    QElapsedTimer m_handoffClock;
+    qint64 m_handoffLatencyUs;
+
+    static constexpr int DEFAULT_SLICE_BUDGET_MS = 10;
+};
+
+#endif // SPLASHSTARTUP_H
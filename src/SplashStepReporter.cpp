@@ -0,0 +1,15 @@
+#include "SplashStepReporter.h"
+
+SplashStepReporter::SplashStepReporter(std::shared_ptr<std::atomic<int>> slot)
+    : m_slot(std::move(slot))
+{
+}
+
+void SplashStepReporter::setFraction(qreal fraction) const
+{
+    if (!m_slot) {
+        return;
+    }
+    const int value = qBound(0, qRound(fraction * RESOLUTION), RESOLUTION);
+    m_slot->store(value, std::memory_order_relaxed);
+}
@@ -0,0 +1,37 @@
+#ifndef SPLASHSTEPREPORTER_H
+#define SPLASHSTEPREPORTER_H
+
+#include <QtGlobal>
+#include <atomic>
+#include <memory>
+
+/**
+ * @brief Lightweight handle used to report progress inside a named step.
+ *
+ * Obtained from SplashScreenWidget::stepReporter(). Copies share the same
+ * slot. setFraction() is a single relaxed atomic store, so worker threads
+ * may call it at any frequency; the splash samples the slot once per frame
+ * and repaints only when the value changed.
+ */
+class SplashStepReporter
+{
+public:
+    static constexpr int RESOLUTION = 10000;
+
+    SplashStepReporter() = default;
+
+    bool isValid() const { return static_cast<bool>(m_slot); }
+
+    /**
+     * @brief Report completion of the step (0.0 - 1.0). Thread-safe.
+     */
+    void setFraction(qreal fraction) const;
+
+private:
+    friend class SplashScreenWidget;
+    explicit SplashStepReporter(std::shared_ptr<std::atomic<int>> slot);
+
+    std::shared_ptr<std::atomic<int>> m_slot;
+};
+
+#endif // SPLASHSTEPREPORTER_H
@@ -0,0 +1,254 @@
+#include "SplashStyleSheetCache.h"
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+#include <QVector>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QWidget>
+#include <QDebug>
+
+SplashStyleSheetCache::SplashStyleSheetCache(const QString &directory)
+    : m_directory(directory)
+{
+}
+
+void SplashStyleSheetCache::setDirectory(const QString &path)
+{
+    m_directory = path;
+}
+
+QString SplashStyleSheetCache::defaultDirectory()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/splash_styles";
+}
+
+SplashStyleSheetCache::Scope SplashStyleSheetCache::scopeOf(const QWidget *root)
+{
+    Scope scope;
+    if (!root) {
+        return scope;
+    }
+
+    QList<const QWidget *> widgets = {root};
+    for (const QWidget *child : root->findChildren<QWidget *>()) {
+        widgets.append(child);
+    }
+
+    // Type selectors match subclasses too: record the whole class chain
+    for (const QWidget *widget : widgets) {
+        for (const QMetaObject *meta = widget->metaObject(); meta; meta = meta->superClass()) {
+            scope.typeNames.insert(QString::fromLatin1(meta->className()));
+        }
+        if (!widget->objectName().isEmpty()) {
+            scope.objectNames.insert(widget->objectName());
+        }
+    }
+    return scope;
+}
+
+QString SplashStyleSheetCache::load(const QString &path, const Scope &scope) const
+{
+    QFile file(path);
+    if (!file.open(QFile::ReadOnly | QFile::Text)) {
+        qWarning() << "SplashScreen: Could not load stylesheet:" << path;
+        return QString();
+    }
+    const QByteArray contents = file.readAll();
+
+    QString entry;
+    if (!m_directory.isEmpty()) {
+        QStringList types = scope.typeNames.values();
+        QStringList names = scope.objectNames.values();
+        types.sort();
+        names.sort();
+
+        QCryptographicHash hash(QCryptographicHash::Sha1);
+        hash.addData(QByteArray::number(FORMAT_VERSION));
+        hash.addData(contents);
+        hash.addData(types.join(',').toUtf8());
+        hash.addData("|");
+        hash.addData(names.join(',').toUtf8());
+        entry = m_directory + "/" + QString::fromLatin1(hash.result().toHex()) + ".qss";
+
+        QFile cached(entry);
+        if (cached.open(QFile::ReadOnly | QFile::Text)) {
+            return QString::fromUtf8(cached.readAll());
+        }
+    }
+
+    bool pruned = false;
+    const QString result = prune(QString::fromUtf8(contents), scope, &pruned);
+
+    if (!entry.isEmpty() && pruned) {
+        QDir().mkpath(m_directory);
+        QSaveFile out(entry);
+        if (!out.open(QFile::WriteOnly | QFile::Text)
+            || out.write(result.toUtf8()) < 0 || !out.commit()) {
+            qWarning() << "SplashScreen: Could not write stylesheet cache entry:" << entry;
+        }
+        trimDirectory();
+    }
+    return result;
+}
+
+QString SplashStyleSheetCache::prune(const QString &styleSheet, const Scope &scope, bool *ok)
+{
+    // Split into top-level rules, honoring strings and comments. Anything
+    // that is not a plain list of "selectors { declarations }" (unbalanced
+    // braces, unterminated strings or comments, declarations without a
+    // selector) is returned unpruned: dropping rules from a sheet we did
+    // not understand could change what it styles.
+    struct Rule {
+        QString selectors;
+        QString body;
+    };
+    QVector<Rule> rules;
+    QString selectorText;
+    QString body;
+    bool inBody = false;
+    bool balanced = true;
+    QChar quote;
+    for (int i = 0; i < styleSheet.size() && balanced; ++i) {
+        const QChar c = styleSheet.at(i);
+        QString &current = inBody ? body : selectorText;
+        if (!quote.isNull()) {
+            current += c;
+            if (c == '\\' && i + 1 < styleSheet.size()) {
+                current += styleSheet.at(++i);
+            } else if (c == quote) {
+                quote = QChar();
+            }
+        } else if (c == '/' && i + 1 < styleSheet.size() && styleSheet.at(i + 1) == '*') {
+            const int end = styleSheet.indexOf(QStringLiteral("*/"), i + 2);
+            balanced = (end >= 0);
+            i = end + 1;
+            current += ' ';
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+            current += c;
+        } else if (c == '{') {
+            balanced = !inBody && !selectorText.trimmed().isEmpty()
+                       && !selectorText.contains(';');
+            inBody = true;
+        } else if (c == '}') {
+            balanced = inBody;
+            rules.append({selectorText, body});
+            selectorText.clear();
+            body.clear();
+            inBody = false;
+        } else {
+            current += c;
+        }
+    }
+    balanced = balanced && quote.isNull() && !inBody && selectorText.trimmed().isEmpty();
+
+    if (ok) {
+        *ok = balanced;
+    }
+    if (!balanced) {
+        qWarning() << "SplashScreen: stylesheet not understood by the pruner, kept whole";
+        return styleSheet;
+    }
+
+    QString result;
+    for (const Rule &rule : rules) {
+        QStringList kept;
+        for (const QString &candidate : splitTopLevel(rule.selectors, ',')) {
+            QString selector = candidate.simplified();
+            selector.replace(QStringLiteral(" > "), QStringLiteral(">"));
+            if (!selector.isEmpty() && selectorCanMatch(selector, scope)) {
+                kept.append(selector);
+            }
+        }
+
+        const QString declarations = minifyDeclarations(rule.body);
+        if (!kept.isEmpty() && !declarations.isEmpty()) {
+            result += kept.join(',') + '{' + declarations + "}\n";
+        }
+    }
+    return result;
+}
+
+void SplashStyleSheetCache::trimDirectory() const
+{
+    // Every theme edit or widget tree change adds an entry: keep the newest
+    QDir directory(m_directory);
+    const QFileInfoList entries = directory.entryInfoList({QStringLiteral("*.qss")}, QDir::Files,
+                                                          QDir::Time);
+    for (int i = MAX_CACHE_ENTRIES; i < entries.size(); ++i) {
+        QFile::remove(entries.at(i).absoluteFilePath());
+    }
+}
+
+bool SplashStyleSheetCache::selectorCanMatch(const QString &selector, const Scope &scope)
+{
+    // Attribute values may hold '#', ':' or spaces: drop them first
+    static const QRegularExpression attributes(QStringLiteral("\\[[^\\]]*\\]"));
+    QString plain = selector;
+    plain.remove(attributes);
+    plain.replace('>', ' ');
+
+    // Every compound (ancestors included) must be able to match something
+    const QStringList compounds = plain.split(' ', Qt::SkipEmptyParts);
+    for (const QString &compound : compounds) {
+        QString base = compound.section(':', 0, 0);
+        if (base.startsWith('.')) {
+            base.remove(0, 1);  // .QLabel: exact class, treated like a type
+        }
+
+        const int hash = base.indexOf('#');
+        const QString type = (hash < 0) ? base : base.left(hash);
+        if (!type.isEmpty() && type != QLatin1String("*") && !scope.typeNames.contains(type)) {
+            return false;
+        }
+        if (hash >= 0 && !scope.objectNames.contains(base.mid(hash + 1))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+QStringList SplashStyleSheetCache::splitTopLevel(const QString &text, QChar separator)
+{
+    QStringList parts;
+    int depth = 0;
+    QChar quote;
+    int start = 0;
+    for (int i = 0; i < text.size(); ++i) {
+        const QChar c = text.at(i);
+        if (!quote.isNull()) {
+            if (c == quote) {
+                quote = QChar();
+            }
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '(' || c == '[') {
+            ++depth;
+        } else if (c == ')' || c == ']') {
+            --depth;
+        } else if (c == separator && depth == 0) {
+            parts.append(text.mid(start, i - start));
+            start = i + 1;
+        }
+    }
+    parts.append(text.mid(start));
+    return parts;
+}
+
+QString SplashStyleSheetCache::minifyDeclarations(const QString &body)
+{
+    QStringList declarations;
+    for (const QString &part : splitTopLevel(body, ';')) {
+        const QString declaration = part.simplified();
+        const int colon = declaration.indexOf(':');
+        if (colon <= 0) {
+            continue;
+        }
+        declarations.append(declaration.left(colon).trimmed() + ':'
+                            + declaration.mid(colon + 1).trimmed());
+    }
+    return declarations.join(';');
+}
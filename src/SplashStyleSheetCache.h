@@ -0,0 +1,83 @@
+#ifndef SPLASHSTYLESHEETCACHE_H
+#define SPLASHSTYLESHEETCACHE_H
+
+#include <QString>
+#include <QStringList>
+#include <QSet>
+
+class QWidget;
+
+/**
+ * @brief Prunes and minifies QSS themes down to the rules a widget tree
+ * can match, and caches the result on disk.
+ *
+ * Application themes style every widget type, but the splash only holds
+ * a handful of classes and object names. QStyleSheetStyle parses and
+ * matches every rule for every widget it polishes, so handing it the
+ * whole theme costs far more than the few rules that apply. A rule is
+ * dropped when any compound of its selector names a type or an #id
+ * absent from the tree. Pseudo-states, sub-controls and attribute
+ * selectors are kept, since they depend on runtime state.
+ *
+ * Cached results are keyed by a hash of the file contents and of the
+ * scope, so an edited theme or a different widget tree never hits a
+ * stale entry; only the newest MAX_CACHE_ENTRIES files are kept. A sheet
+ * the pruner cannot split into plain rules is used unpruned. All methods
+ * are reentrant.
+ */
+class SplashStyleSheetCache
+{
+public:
+    static constexpr int FORMAT_VERSION = 2;
+    static constexpr int MAX_CACHE_ENTRIES = 16;
+
+    /**
+     * @brief Class names (with superclasses) and object names in a tree
+     */
+    struct Scope {
+        QSet<QString> typeNames;
+        QSet<QString> objectNames;
+    };
+
+    explicit SplashStyleSheetCache(const QString &directory = QString());
+
+    /**
+     * @brief Cache directory; an empty path prunes without caching.
+     */
+    void setDirectory(const QString &path);
+    QString directory() const { return m_directory; }
+
+    /**
+     * @brief Read @p path and return its rules pruned to @p scope.
+     * @return The stylesheet, or a null string if the file is unreadable
+     */
+    QString load(const QString &path, const Scope &scope) const;
+
+    /**
+     * @brief Collect the scope of @p root and all of its child widgets.
+     */
+    static Scope scopeOf(const QWidget *root);
+
+    /**
+     * @brief Drop unmatchable rules and comments; collapse whitespace.
+     * @param ok Set to false when the sheet could not be parsed (unbalanced
+     * braces, unterminated strings or comments, declarations outside a
+     * rule); @p styleSheet is then returned unchanged
+     */
+    static QString prune(const QString &styleSheet, const Scope &scope, bool *ok = nullptr);
+
+    /**
+     * @brief Default location under the application cache directory.
+     */
+    static QString defaultDirectory();
+
+private:
+    static bool selectorCanMatch(const QString &selector, const Scope &scope);
+    static QStringList splitTopLevel(const QString &text, QChar separator);
+    static QString minifyDeclarations(const QString &body);
+    void trimDirectory() const;
+
+    QString m_directory;
+};
+
+#endif // SPLASHSTYLESHEETCACHE_H
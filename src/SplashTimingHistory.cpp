@@ -0,0 +1,128 @@
+#include "SplashTimingHistory.h"
+#include <QFile>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QDebug>
+#include <algorithm>
+
+SplashTimingHistory::SplashTimingHistory(const QString &filePath)
+    : m_filePath(filePath)
+{
+}
+
+void SplashTimingHistory::setFilePath(const QString &path)
+{
+    m_filePath = path;
+}
+
+QString SplashTimingHistory::defaultFilePath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation)
+           + "/splash_timings.json";
+}
+
+bool SplashTimingHistory::load()
+{
+    m_samples.clear();
+
+    QFile file(m_filePath);
+    if (!file.exists()) {
+        return true;
+    }
+    if (!file.open(QFile::ReadOnly)) {
+        qWarning() << "SplashScreen: Could not read timing history:" << m_filePath;
+        return false;
+    }
+
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+    if (!doc.isObject()) {
+        qWarning() << "SplashScreen: Ignoring malformed timing history:" << m_filePath;
+        return false;
+    }
+
+    const QJsonObject steps = doc.object().value("steps").toObject();
+    for (auto it = steps.constBegin(); it != steps.constEnd(); ++it) {
+        QVector<qint64> samples;
+        const QJsonArray array = it.value().toArray();
+        for (const QJsonValue &value : array) {
+            const qint64 ms = value.toInteger(-1);
+            if (ms >= 0) {
+                samples.append(ms);
+            }
+        }
+        if (samples.size() > MAX_SAMPLES) {
+            samples.remove(0, samples.size() - MAX_SAMPLES);
+        }
+        if (!samples.isEmpty()) {
+            m_samples.insert(it.key(), samples);
+        }
+    }
+    return true;
+}
+
+bool SplashTimingHistory::save() const
+{
+    if (m_filePath.isEmpty()) {
+        return false;
+    }
+
+    QDir().mkpath(QFileInfo(m_filePath).absolutePath());
+
+    QJsonObject steps;
+    for (auto it = m_samples.constBegin(); it != m_samples.constEnd(); ++it) {
+        QJsonArray array;
+        for (qint64 ms : it.value()) {
+            array.append(ms);
+        }
+        steps.insert(it.key(), array);
+    }
+
+    QJsonObject root;
+    root.insert("version", 1);
+    root.insert("steps", steps);
+
+    QSaveFile file(m_filePath);
+    if (!file.open(QFile::WriteOnly)) {
+        qWarning() << "SplashScreen: Could not write timing history:" << m_filePath;
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    return file.commit();
+}
+
+void SplashTimingHistory::addSample(const QString &name, qint64 milliseconds)
+{
+    QVector<qint64> &samples = m_samples[name];
+    samples.append(qMax<qint64>(0, milliseconds));
+    if (samples.size() > MAX_SAMPLES) {
+        samples.removeFirst();
+    }
+}
+
+qint64 SplashTimingHistory::expectedDuration(const QString &name, qint64 fallbackMs) const
+{
+    const auto it = m_samples.constFind(name);
+    if (it == m_samples.constEnd() || it->isEmpty()) {
+        return fallbackMs;
+    }
+
+    QVector<qint64> sorted = *it;
+    std::sort(sorted.begin(), sorted.end());
+    const qint64 median = sorted[sorted.size() / 2];
+
+    // Rolling average over samples within OUTLIER_FACTOR of the median
+    qint64 sum = 0;
+    int count = 0;
+    for (qint64 ms : sorted) {
+        if (ms * OUTLIER_FACTOR >= median && ms <= median * OUTLIER_FACTOR) {
+            sum += ms;
+            count++;
+        }
+    }
+    return (count > 0) ? sum / count : median;
+}
@@ -0,0 +1,62 @@
+#ifndef SPLASHTIMINGHISTORY_H
+#define SPLASHTIMINGHISTORY_H
+
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QVector>
+
+/**
+ * @brief Persisted per-step duration history for the splash screen.
+ *
+ * Stores the last MAX_SAMPLES durations of every named initialization
+ * step in a small JSON file. The expected duration of a step is a rolling
+ * average in which samples further than a factor of two from the median
+ * are discarded, so a single slow (or unusually fast) run cannot skew it.
+ */
+class SplashTimingHistory
+{
+public:
+    static constexpr int MAX_SAMPLES = 8;
+    static constexpr double OUTLIER_FACTOR = 2.0;
+
+    explicit SplashTimingHistory(const QString &filePath = QString());
+
+    void setFilePath(const QString &path);
+    QString filePath() const { return m_filePath; }
+
+    /**
+     * @brief Read samples from filePath(). Missing files are not an error.
+     */
+    bool load();
+
+    /**
+     * @brief Write samples to filePath(), creating the directory if needed.
+     */
+    bool save() const;
+
+    /**
+     * @brief Append a duration sample, dropping the oldest beyond MAX_SAMPLES.
+     */
+    void addSample(const QString &name, qint64 milliseconds);
+
+    bool contains(const QString &name) const { return m_samples.contains(name); }
+
+    /**
+     * @brief Outlier-filtered rolling average for a step.
+     * @param name Step name
+     * @param fallbackMs Returned when no samples exist for the step
+     */
+    qint64 expectedDuration(const QString &name, qint64 fallbackMs) const;
+
+    /**
+     * @brief Default history location under the application data directory.
+     */
+    static QString defaultFilePath();
+
+private:
+    QHash<QString, QVector<qint64>> m_samples;
+    QString m_filePath;
+};
+
+#endif // SPLASHTIMINGHISTORY_H
@@ -0,0 +1,222 @@
+#include "StartupTaskScheduler.h"
+#include <QTimer>
+#include <QThread>
+#include <QDebug>
+
+StartupTaskScheduler::StartupTaskScheduler(QObject *parent)
+    : QObject(parent)
+    , m_completedCount(0)
+    , m_running(false)
+    , m_cancelled(false)
+{
+    m_pool.setMaxThreadCount(QThread::idealThreadCount());
+}
+
+StartupTaskScheduler::~StartupTaskScheduler()
+{
+    m_cancelled = true;
+    m_pool.waitForDone();
+}
+
+void StartupTaskScheduler::addTask(const QString &name,
+                                   const QString &description,
+                                   std::function<void()> method,
+                                   Affinity affinity,
+                                   const QStringList &dependencies)
+{
+    if (m_running) {
+        qWarning() << "StartupTaskScheduler: Cannot add task while running:" << name;
+        return;
+    }
+    if (m_indexByName.contains(name)) {
+        qWarning() << "StartupTaskScheduler: Duplicate task name:" << name;
+        return;
+    }
+
+    Task task;
+    task.name = name;
+    task.description = description;
+    task.method = std::move(method);
+    task.affinity = affinity;
+    task.dependencies = dependencies;
+    task.pendingDependencies = 0;
+    task.started = false;
+
+    m_indexByName.insert(name, m_tasks.size());
+    m_tasks.append(task);
+}
+
+void StartupTaskScheduler::setMaxConcurrency(int threads)
+{
+    m_pool.setMaxThreadCount(qMax(1, threads));
+}
+
+QStringList StartupTaskScheduler::taskNames() const
+{
+    QStringList names;
+    for (const auto &task : m_tasks) {
+        names.append(task.name);
+    }
+    return names;
+}
+
+QString StartupTaskScheduler::taskDescription(const QString &name) const
+{
+    const int index = m_indexByName.value(name, -1);
+    return (index >= 0) ? m_tasks[index].description : QString();
+}
+
+bool StartupTaskScheduler::buildGraph(QString *error)
+{
+    for (auto &task : m_tasks) {
+        task.dependents.clear();
+        task.pendingDependencies = 0;
+        task.started = false;
+    }
+
+    for (int i = 0; i < m_tasks.size(); ++i) {
+        for (const QString &dependency : m_tasks[i].dependencies) {
+            const int depIndex = m_indexByName.value(dependency, -1);
+            if (depIndex < 0) {
+                *error = QString("Task '%1' depends on unknown task '%2'")
+                             .arg(m_tasks[i].name, dependency);
+                return false;
+            }
+            m_tasks[depIndex].dependents.append(i);
+            m_tasks[i].pendingDependencies++;
+        }
+    }
+
+    // Kahn's algorithm: every task must be reachable from a root
+    QVector<int> pending(m_tasks.size());
+    QVector<int> ready;
+    for (int i = 0; i < m_tasks.size(); ++i) {
+        pending[i] = m_tasks[i].pendingDependencies;
+        if (pending[i] == 0) {
+            ready.append(i);
+        }
+    }
+
+    int visited = 0;
+    while (!ready.isEmpty()) {
+        const int index = ready.takeLast();
+        visited++;
+        for (int dependent : m_tasks[index].dependents) {
+            if (--pending[dependent] == 0) {
+                ready.append(dependent);
+            }
+        }
+    }
+
+    if (visited != m_tasks.size()) {
+        *error = QString("Startup task graph contains a dependency cycle");
+        return false;
+    }
+    return true;
+}
+
+void StartupTaskScheduler::start()
+{
+    if (m_running) {
+        return;
+    }
+
+    QString error;
+    if (!buildGraph(&error)) {
+        qWarning() << "StartupTaskScheduler:" << error;
+        emit failed(error);
+        return;
+    }
+
+    m_completedCount = 0;
+    m_cancelled = false;
+    m_running = true;
+
+    if (m_tasks.isEmpty()) {
+        m_running = false;
+        emit allTasksFinished();
+        return;
+    }
+
+    launchReadyTasks();
+}
+
+void StartupTaskScheduler::cancel()
+{
+    m_cancelled = true;
+}
+
+bool StartupTaskScheduler::waitForDone(int msecs)
+{
+    return m_pool.waitForDone(msecs);
+}
+
+void StartupTaskScheduler::launchReadyTasks()
+{
+    // Launch worker tasks first so they overlap with any main-thread
+    // task that is queued in the same pass.
+    for (int pass = 0; pass < 2; ++pass) {
+        const Affinity affinity = (pass == 0) ? Affinity::WorkerThread : Affinity::MainThread;
+        for (int i = 0; i < m_tasks.size(); ++i) {
+            const Task &task = m_tasks[i];
+            if (!task.started && task.pendingDependencies == 0 && task.affinity == affinity) {
+                launchTask(i);
+            }
+        }
+    }
+}
+
+void StartupTaskScheduler::launchTask(int index)
+{
+    if (m_cancelled) {
+        return;
+    }
+
+    Task &task = m_tasks[index];
+    task.started = true;
+    emit taskStarted(task.name, task.description);
+
+    std::function<void()> method = task.method;
+
+    if (task.affinity == Affinity::WorkerThread) {
+        m_pool.start([this, index, method]() {
+            if (!m_cancelled) {
+                method();
+            }
+            // Completion bookkeeping always happens on the owner thread
+            QMetaObject::invokeMethod(this, [this, index]() {
+                onTaskFinished(index);
+            }, Qt::QueuedConnection);
+        });
+    } else {
+        QTimer::singleShot(0, this, [this, index, method]() {
+            if (m_cancelled) {
+                return;
+            }
+            method();
+            onTaskFinished(index);
+        });
+    }
+}
+
+void StartupTaskScheduler::onTaskFinished(int index)
+{
+    if (m_cancelled) {
+        return;
+    }
+
+    m_completedCount++;
+    emit taskFinished(m_tasks[index].name, m_completedCount);
+
+    for (int dependent : m_tasks[index].dependents) {
+        m_tasks[dependent].pendingDependencies--;
+    }
+
+    if (m_completedCount == m_tasks.size()) {
+        m_running = false;
+        emit allTasksFinished();
+        return;
+    }
+
+    launchReadyTasks();
+}
@@ -0,0 +1,134 @@
+#ifndef STARTUPTASKSCHEDULER_H
+#define STARTUPTASKSCHEDULER_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QHash>
+#include <QThreadPool>
+#include <functional>
+#include <atomic>
+
+/**
+ * @brief Dependency-graph scheduler for application startup tasks.
+ *
+ * Each task declares the names of the tasks it depends on. Once started,
+ * every task whose dependencies have finished is launched immediately:
+ * worker tasks run concurrently on a private thread pool, main-thread
+ * tasks are queued on the GUI event loop. Wall-clock startup time is
+ * therefore the critical path of the graph rather than the sum of all
+ * task durations.
+ *
+ * All signals are emitted on the thread that owns the scheduler
+ * (normally the GUI thread), so they can be connected directly to
+ * SplashScreenWidget slots.
+ */
+class StartupTaskScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Thread on which a task body is executed
+     */
+    enum class Affinity {
+        MainThread,     ///< Queued on the owner's event loop
+        WorkerThread    ///< Run on the scheduler thread pool
+    };
+
+    explicit StartupTaskScheduler(QObject *parent = nullptr);
+    ~StartupTaskScheduler() override;
+
+    /**
+     * @brief Register a task. Must be called before start().
+     * @param name Unique task identifier used by dependency lists
+     * @param description Human-readable text (shown on the splash)
+     * @param method Task body
+     * @param affinity Thread the body runs on
+     * @param dependencies Names of tasks that must finish first
+     */
+    void addTask(const QString &name,
+                 const QString &description,
+                 std::function<void()> method,
+                 Affinity affinity,
+                 const QStringList &dependencies = QStringList());
+
+    /**
+     * @brief Validate the graph and launch every task that is ready.
+     * Emits failed() if a dependency is unknown or the graph has a cycle.
+     */
+    void start();
+
+    /**
+     * @brief Stop launching new tasks. Running tasks are not interrupted.
+     */
+    void cancel();
+
+    /**
+     * @brief Block until all worker tasks have returned.
+     * @param msecs Timeout in milliseconds (-1 waits forever)
+     * @return true if the pool drained before the timeout
+     */
+    bool waitForDone(int msecs = -1);
+
+    void setMaxConcurrency(int threads);
+
+    int taskCount() const { return m_tasks.size(); }
+    int completedCount() const { return m_completedCount; }
+    bool isRunning() const { return m_running; }
+    QStringList taskNames() const;
+    QString taskDescription(const QString &name) const;
+
+signals:
+    /**
+     * @brief Emitted when a task is launched.
+     * @param name Task identifier
+     * @param description Task description
+     */
+    void taskStarted(const QString &name, const QString &description);
+
+    /**
+     * @brief Emitted when a task returns.
+     * @param name Task identifier
+     * @param completed Number of finished tasks so far (1-based, monotonic
+     *        regardless of the order in which tasks finish)
+     */
+    void taskFinished(const QString &name, int completed);
+
+    /**
+     * @brief Emitted once every task has finished.
+     */
+    void allTasksFinished();
+
+    /**
+     * @brief Emitted if the task graph is invalid.
+     */
+    void failed(const QString &error);
+
+private:
+    struct Task {
+        QString name;
+        QString description;
+        std::function<void()> method;
+        Affinity affinity;
+        QStringList dependencies;
+        QVector<int> dependents;
+        int pendingDependencies;
+        bool started;
+    };
+
+    bool buildGraph(QString *error);
+    void launchReadyTasks();
+    void launchTask(int index);
+    void onTaskFinished(int index);
+
+    QVector<Task> m_tasks;
+    QHash<QString, int> m_indexByName;
+    QThreadPool m_pool;
+    int m_completedCount;
+    bool m_running;
+    std::atomic<bool> m_cancelled;
+};
+
+#endif // STARTUPTASKSCHEDULER_H
@@ -0,0 +1,142 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+
+#include "SplashScreenWidget.h"
+#include "SplashAssetBundle.h"
+#include "SplashLogoCache.h"
+#include "SplashStyleSheetCache.h"
+
+/**
+ * @brief Build-time generator for SplashAssetBundle files.
+ *
+ * Usage:
+ *   qt-splash-screen-bundler --output splash.bundle --logo app_logo.svg
+ *       [--logo-size 120x120] [--company-logo logo.svg] [--company-logo-size 110x30]
+ *       [--style light.qss] [--dpr 1,1.25,1.5,2]
+ *
+ * Logos are rasterized once per device pixel ratio; the stylesheet is
+ * pruned against the widget tree of a default SplashScreenWidget.
+ */
+
+namespace {
+
+QSize parseSize(const QString &text, const QSize &fallback)
+{
+    const QStringList parts = text.split('x');
+    if (parts.size() != 2) {
+        return fallback;
+    }
+    const QSize size(parts[0].toInt(), parts[1].toInt());
+    return size.isValid() && !size.isEmpty() ? size : fallback;
+}
+
+QJsonArray sizeToJson(const QSize &size)
+{
+    return QJsonArray{size.width(), size.height()};
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    // Runs during the build: never needs a display
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+    QTextStream err(stderr);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Generate a memory-mappable splash asset bundle");
+    parser.addHelpOption();
+    const QCommandLineOption outputOption("output", "Bundle file to write.", "file");
+    const QCommandLineOption logoOption("logo", "Application logo (SVG).", "svg");
+    const QCommandLineOption logoSizeOption("logo-size", "Logo size in logical pixels.", "WxH", "128x128");
+    const QCommandLineOption companyOption("company-logo", "Company logo (SVG).", "svg");
+    const QCommandLineOption companySizeOption("company-logo-size", "Company logo size.", "WxH", "90x26");
+    const QCommandLineOption styleOption("style", "Stylesheet (QSS) to prune and embed.", "qss");
+    const QCommandLineOption dprOption("dpr", "Device pixel ratios to rasterize.", "list", "1,1.25,1.5,2");
+    parser.addOptions({outputOption, logoOption, logoSizeOption, companyOption, companySizeOption,
+                       styleOption, dprOption});
+    parser.process(app);
+
+    if (!parser.isSet(outputOption)) {
+        err << "error: --output is required\n";
+        return 1;
+    }
+
+    const QSize logoSize = parseSize(parser.value(logoSizeOption), QSize(128, 128));
+    const QSize companySize = parseSize(parser.value(companySizeOption), QSize(90, 26));
+    QVector<qreal> ratios;
+    for (const QString &value : parser.value(dprOption).split(',', Qt::SkipEmptyParts)) {
+        const qreal ratio = value.toDouble();
+        if (ratio > 0.0) {
+            ratios.append(ratio);
+        }
+    }
+
+    QVector<SplashAssetBundle::Entry> entries;
+    QJsonObject metadata;
+    metadata.insert("formatVersion", static_cast<int>(SplashAssetBundle::FORMAT_VERSION));
+
+    const struct {
+        QCommandLineOption option;
+        const char *name;
+        QSize size;
+        const char *sizeKey;
+    } logos[] = {
+        {logoOption, "logo", logoSize, "logoSize"},
+        {companyOption, "companyLogo", companySize, "companyLogoSize"},
+    };
+    for (const auto &logo : logos) {
+        if (!parser.isSet(logo.option)) {
+            continue;
+        }
+        const QString path = parser.value(logo.option);
+        for (qreal ratio : ratios) {
+            const QImage image = SplashLogoCache::rasterize(path, logo.size, ratio);
+            if (image.isNull()) {
+                err << "error: cannot rasterize " << path << "\n";
+                return 1;
+            }
+            SplashAssetBundle::Entry entry;
+            entry.name = logo.name;
+            entry.image = image;
+            entries.append(entry);
+        }
+        metadata.insert(logo.sizeKey, sizeToJson(logo.size));
+        metadata.insert(QString(logo.name) + "Source", QFileInfo(path).fileName());
+    }
+
+    if (parser.isSet(styleOption)) {
+        const SplashScreenWidget reference;
+        const QString pruned = SplashStyleSheetCache(QString()).load(
+            parser.value(styleOption), SplashStyleSheetCache::scopeOf(&reference));
+        if (pruned.isNull()) {
+            err << "error: cannot read " << parser.value(styleOption) << "\n";
+            return 1;
+        }
+        SplashAssetBundle::Entry style;
+        style.name = "style";
+        style.data = pruned.toUtf8();
+        entries.append(style);
+        metadata.insert("styleSource", QFileInfo(parser.value(styleOption)).fileName());
+    }
+
+    SplashAssetBundle::Entry meta;
+    meta.name = "metadata";
+    meta.data = QJsonDocument(metadata).toJson(QJsonDocument::Compact);
+    entries.append(meta);
+
+    if (!SplashAssetBundle::write(parser.value(outputOption), entries)) {
+        err << "error: cannot write " << parser.value(outputOption) << "\n";
+        return 1;
+    }
+    return 0;
+}